@@ -223,6 +223,7 @@ class CryptoSymmetricDecryptOutput;
 class Data;
 class Flag;
 class Identifier;
+class IntervalSet;
 class Item;
 class Ledger;
 class Letter;
@@ -361,5 +362,10 @@ struct less<opentxs::OTIdentifier> {
         const opentxs::OTIdentifier& lhs,
         const opentxs::OTIdentifier& rhs) const;
 };
+
+template <>
+struct hash<opentxs::OTIdentifier> {
+    std::size_t operator()(const opentxs::OTIdentifier& id) const;
+};
 }  // namespace std
 #endif
@@ -20,6 +20,14 @@
 
 namespace opentxs
 {
+namespace network
+{
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
+}  // namespace network
+
 class Message;
 class Nym;
 class String;
@@ -505,6 +513,18 @@ enum class transactionType : std::int8_t {
 };  // If you add any types to this list, update the list of strings at the
 // top of OTTransaction.cpp.
 
+// Encoding of a legacy OTX message on the wire. When a request carries this
+// value in a frame following the message, the peer may reply with RAW.
+enum class LegacyEncoding : std::uint8_t {
+    ARMORED = 0,
+    RAW = 1,
+};
+
+// Returns false unless the message carries a valid encoding frame
+bool read_legacy_encoding(
+    const network::zeromq::Message& message,
+    LegacyEncoding& encoding);
+
 enum class SendResult : std::int8_t {
     TRANSACTION_NUMBERS = -3,
     INVALID_REPLY = -2,
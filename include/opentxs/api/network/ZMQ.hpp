@@ -33,6 +33,9 @@ public:
     EXPORT virtual OTZMQContext NewContext() const = 0;
     EXPORT virtual std::chrono::seconds ReceiveTimeout() const = 0;
     EXPORT virtual const Flag& Running() const = 0;
+    /** Whether legacy messages may be sent without zlib and base64 armoring
+     *  to notaries which support it */
+    EXPORT virtual bool RawTransport() const = 0;
     EXPORT virtual void RefreshConfig() const = 0;
     EXPORT virtual std::chrono::seconds SendTimeout() const = 0;
     EXPORT virtual opentxs::network::ServerConnection& Server(
@@ -11,6 +11,7 @@
 #include <future>
 #include <memory>
 #include <string>
+#include <typeinfo>
 
 namespace opentxs
 {
@@ -76,6 +77,22 @@ public:
 protected:
     Driver() = default;
 
+    /** Returns a previously validated object stored under hash, if any */
+    virtual std::shared_ptr<const void> cached(
+        const std::string&,
+        const std::type_info&) const
+    {
+        return {};
+    }
+    /** Offers a validated object to the driver's read cache */
+    virtual void cache(
+        const std::string&,
+        const std::type_info&,
+        const std::shared_ptr<const void>&,
+        const std::size_t) const
+    {
+    }
+
 private:
     Driver(const Driver&) = delete;
     Driver(Driver&&) = delete;
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <ctime>
 #include <functional>
+#include <future>
 #include <memory>
 #include <set>
 #include <string>
@@ -52,6 +53,13 @@ public:
         const Identifier& server) const = 0;
     virtual std::set<OTIdentifier> AccountsByUnit(
         const proto::ContactItemType unit) const = 0;
+    /** Defer root commits until the matching EndBatch call
+     *
+     *  Batches may be nested. Writes made inside a batch are visible to
+     *  readers immediately but are not durable until the outermost batch
+     *  ends.
+     */
+    virtual void BeginBatch() const = 0;
     virtual OTIdentifier Bip47AddressToChannel(
         const Identifier& nymID,
         const std::string& address) const = 0;
@@ -103,6 +111,14 @@ public:
     virtual bool DeletePaymentWorkflow(
         const std::string& nymID,
         const std::string& workflowID) const = 0;
+    /** Resolves once every write made before this call is durable */
+    virtual std::shared_future<bool> Durable() const = 0;
+    /** Ends a batch started by BeginBatch
+     *
+     *  The returned future resolves once the writes made in the batch are
+     *  durable.
+     */
+    virtual std::shared_future<bool> EndBatch() const = 0;
     virtual std::uint32_t HashType() const = 0;
     virtual ObjectList IssuerList(const std::string& nymID) const = 0;
     virtual bool Load(
@@ -349,6 +365,7 @@ public:
         const std::string& threadID) const = 0;
     virtual std::string UnitDefinitionAlias(const std::string& id) const = 0;
     virtual ObjectList UnitDefinitionList() const = 0;
+    virtual std::size_t UnreadCount(const std::string& nymId) const = 0;
     virtual std::size_t UnreadCount(
         const std::string& nymId,
         const std::string& threadId) const = 0;
@@ -14,6 +14,9 @@
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -22,6 +25,9 @@ typedef std::map<std::int64_t, Armored*> mapOfArmor;
 class Mint : public Contract
 {
 public:
+    // Private and public key information for a single denomination
+    typedef std::pair<std::string, std::string> KeyPair;
+
     inline std::int32_t GetSeries() const
     {
         return m_nSeries;
@@ -70,6 +76,17 @@ public:
         const Nym& theNotary,
         std::int64_t lDenomination,
         std::int32_t nPrimeLength = 1024) = 0;
+    // Generates the key pair for one denomination without modifying the mint,
+    // so it may be called from several threads at once.
+    virtual bool GenerateKeys(
+        KeyPair& keys,
+        std::int32_t nPrimeLength = 1024) const = 0;
+    // Seals the private half of a key pair from GenerateKeys to the notary
+    // and adds the pair to the mint.
+    bool SetDenominationKeys(
+        const Nym& theNotary,
+        std::int64_t lDenomination,
+        const KeyPair& keys);
 
     inline std::int32_t GetDenominationCount() const
     {
@@ -109,6 +126,19 @@ public:
         std::int64_t nDenom8 = 0,
         std::int64_t nDenom9 = 0,
         std::int64_t nDenom10 = 0);
+    // Generates the key pairs for all denominations in parallel. Any key pairs
+    // supplied in keys are used before new ones are generated.
+    bool GenerateNewMint(
+        const api::Wallet& wallet,
+        std::int32_t nSeries,
+        time64_t VALID_FROM,
+        time64_t VALID_TO,
+        time64_t MINT_EXPIRATION,
+        const Identifier& theInstrumentDefinitionID,
+        const Identifier& theNotaryID,
+        const Nym& theNotary,
+        const std::vector<std::int64_t>& denominations,
+        std::vector<KeyPair>&& keys = {});
 
     // step 2: (coin request is in Token)
 
@@ -118,6 +148,14 @@ public:
         Token& theToken,
         String& theOutput,
         std::int32_t nTokenIndex) = 0;
+    // Signs a batch of tokens, placing the signature for each token at the
+    // same position in signatures. The signature is left empty for any token
+    // which could not be signed, in which case false is returned.
+    virtual bool SignTokens(
+        const Nym& theNotary,
+        const std::vector<Token*>& tokens,
+        std::vector<std::string>& signatures,
+        std::int32_t nTokenIndex);
 
     // step 4: (unblind coin is in Token)
 
@@ -126,6 +164,13 @@ public:
         const Nym& theNotary,
         String& theCleartextToken,
         std::int64_t lDenomination) = 0;
+    // Verifies a batch of cleartext tokens and their denominations, placing
+    // the result for each token at the same position in verified. Returns
+    // true if every token is valid.
+    virtual bool VerifyTokens(
+        const Nym& theNotary,
+        const std::vector<std::pair<std::string, std::int64_t>>& tokens,
+        std::vector<bool>& verified);
 
     virtual ~Mint();
 
@@ -14,6 +14,13 @@
 #include "opentxs/core/String.hpp"
 
 #include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Bank;
 
 namespace opentxs
 {
@@ -40,16 +47,27 @@ public:
         const Nym& theNotary,
         std::int64_t lDenomination,
         std::int32_t nPrimeLength = 1024) override;
+    bool GenerateKeys(KeyPair& keys, std::int32_t nPrimeLength = 1024)
+        const override;
 
     EXPORT bool SignToken(
         const Nym& theNotary,
         Token& theToken,
         String& theOutput,
         std::int32_t nTokenIndex) override;
+    EXPORT bool SignTokens(
+        const Nym& theNotary,
+        const std::vector<Token*>& tokens,
+        std::vector<std::string>& signatures,
+        std::int32_t nTokenIndex) override;
     EXPORT bool VerifyToken(
         const Nym& theNotary,
         String& theCleartextToken,
         std::int64_t lDenomination) override;
+    EXPORT bool VerifyTokens(
+        const Nym& theNotary,
+        const std::vector<std::pair<std::string, std::int64_t>>& tokens,
+        std::vector<bool>& verified) override;
 
     EXPORT ~MintLucre() = default;
 
@@ -58,6 +76,22 @@ private:
 
     typedef Mint ot_super;
 
+    std::mutex bank_lock_;
+    // Opened private key information for each denomination, along with the
+    // ciphertext it was opened from
+    std::map<std::int64_t, std::pair<std::string, std::string>> private_banks_;
+
+    bool private_bank(
+        const Nym& theNotary,
+        const std::int64_t lDenomination,
+        std::map<std::int64_t, std::string>& output);
+    bool sign(
+        Bank& bank,
+        Token& theToken,
+        String& theOutput,
+        std::int32_t nTokenIndex) const;
+    bool verify(Bank& bank, const std::string& theCleartextToken) const;
+
     MintLucre(const api::Core& core);
     EXPORT MintLucre(
         const api::Core& core,
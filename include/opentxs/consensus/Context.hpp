@@ -10,6 +10,7 @@
 
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/core/contract/Signable.hpp"
+#include "opentxs/core/IntervalSet.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
@@ -76,10 +77,10 @@ protected:
     const api::Core& api_;
     const OTIdentifier server_id_;
     std::shared_ptr<const class Nym> remote_nym_{};
-    std::set<TransactionNumber> available_transaction_numbers_{};
-    std::set<TransactionNumber> issued_transaction_numbers_{};
+    IntervalSet available_transaction_numbers_{};
+    IntervalSet issued_transaction_numbers_{};
     std::atomic<RequestNumber> request_number_{0};
-    std::set<RequestNumber> acknowledged_request_numbers_{};
+    IntervalSet acknowledged_request_numbers_{};
     OTIdentifier local_nymbox_hash_;
     OTIdentifier remote_nymbox_hash_;
 
@@ -91,9 +92,7 @@ protected:
     virtual proto::Context serialize(const Lock& lock) const = 0;
 
     bool add_acknowledged_number(const Lock& lock, const RequestNumber req);
-    void finish_acknowledgements(
-        const Lock& lock,
-        const std::set<RequestNumber>& req);
+    void finish_acknowledgements(const Lock& lock, const IntervalSet& req);
     bool issue_number(const Lock& lock, const TransactionNumber& number);
     bool remove_acknowledged_number(
         const Lock& lock,
@@ -107,6 +107,9 @@ public:
     NetworkReplyMessage PingNotary();
     bool RemoveTentativeNumber(const TransactionNumber& number);
     bool Resync(const proto::Context& serialized);
+    /** Called when the notary has said that it accepts range encoded
+     *  transaction statements */
+    void SetAcceptsRanges();
     void SetAdminAttempted();
     void SetAdminPassword(const std::string& password);
     void SetAdminSuccess();
@@ -133,6 +136,7 @@ private:
     std::string admin_password_{""};
     OTFlag admin_attempted_;
     OTFlag admin_success_;
+    OTFlag accepts_ranges_;
     std::atomic<std::uint64_t> revision_{0};
     std::atomic<TransactionNumber> highest_transaction_number_{0};
     std::set<TransactionNumber> tentative_transaction_numbers_{};
@@ -85,6 +85,8 @@ public:
 
 #ifndef SWIG
     EXPORT virtual void GetString(String& theStr) const = 0;
+    /** Hash of the binary value, suitable for unordered containers */
+    EXPORT virtual std::size_t Hash() const = 0;
 #endif
     EXPORT virtual std::string str() const = 0;
     EXPORT virtual const ID& Type() const = 0;
@@ -0,0 +1,121 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CORE_INTERVALSET_HPP
+#define OPENTXS_CORE_INTERVALSET_HPP
+
+#include "opentxs/Forward.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace opentxs
+{
+/** A set of integers stored as a list of contiguous ranges.
+ *
+ *  Transaction and request numbers are issued in blocks, so a set holding
+ *  thousands of them usually collapses into a handful of ranges. The
+ *  container and iterator methods mirror std::set so that it can replace one
+ *  without changing the code which uses it.
+ *
+ *  Encode writes a plain comma-separated list of numbers, which every version
+ *  of the protocol understands. EncodeRanges writes each range as its first
+ *  and last values joined by a hyphen, for example "1-5,7,9-12", and must only
+ *  be used where the reader is known to accept it. Decode accepts both forms.
+ */
+class IntervalSet
+{
+public:
+    using value_type = std::int64_t;
+    /** Each entry maps the first value of a range to its last value */
+    using Ranges = std::map<value_type, value_type>;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = IntervalSet::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        EXPORT reference operator*() const { return value_; }
+        EXPORT pointer operator->() const { return &value_; }
+        EXPORT const_iterator& operator++();
+        EXPORT const_iterator operator++(int);
+        EXPORT bool operator==(const const_iterator& rhs) const;
+        EXPORT bool operator!=(const const_iterator& rhs) const;
+
+        EXPORT const_iterator() = default;
+        EXPORT const_iterator(const const_iterator&) = default;
+        EXPORT const_iterator& operator=(const const_iterator&) = default;
+
+        EXPORT ~const_iterator() = default;
+
+    private:
+        friend IntervalSet;
+
+        const Ranges* ranges_{nullptr};
+        Ranges::const_iterator range_{};
+        value_type value_{0};
+
+        const_iterator(
+            const Ranges& ranges,
+            const Ranges::const_iterator range,
+            const value_type value);
+    };
+
+    EXPORT const_iterator begin() const;
+    EXPORT std::size_t count(const value_type value) const;
+    EXPORT bool empty() const { return ranges_.empty(); }
+    EXPORT std::string Encode() const;
+    EXPORT std::string EncodeRanges() const;
+    EXPORT const_iterator end() const;
+    EXPORT const Ranges& GetRanges() const { return ranges_; }
+    /** Expands the ranges into individual values */
+    EXPORT std::set<value_type> Set() const;
+    EXPORT std::size_t size() const { return size_; }
+
+    EXPORT void clear();
+    /** Replaces the contents with the decoded values
+     *
+     *  Returns false if the input is malformed or decodes to more than
+     *  OT_MAX_DECODED_NUMS values, in which case only the values which
+     *  precede the error are present.
+     */
+    EXPORT bool Decode(const std::string& encoded);
+    EXPORT std::size_t erase(const value_type value);
+    EXPORT std::pair<const_iterator, bool> insert(const value_type value);
+    /** Adds every value from first to last inclusive
+     *
+     *  Returns the number of values which were not already present.
+     */
+    EXPORT std::size_t InsertRange(
+        const value_type first,
+        const value_type last);
+
+    EXPORT bool operator==(const IntervalSet& rhs) const;
+    EXPORT bool operator!=(const IntervalSet& rhs) const;
+
+    EXPORT IntervalSet();
+    EXPORT explicit IntervalSet(const std::set<value_type>& values);
+    EXPORT IntervalSet(const IntervalSet& rhs) = default;
+    EXPORT IntervalSet& operator=(const IntervalSet& rhs) = default;
+
+    EXPORT ~IntervalSet() = default;
+
+private:
+    Ranges ranges_;
+    std::size_t size_{0};
+
+    static std::size_t width(const value_type first, const value_type last);
+};
+}  // namespace opentxs
+#endif
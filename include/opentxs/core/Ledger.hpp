@@ -124,6 +124,12 @@ public:
     // it.
     //
     EXPORT bool VerifyAccount(const Nym& theNym) override;
+    // Verifies the ID and signature of the box without loading any of its box
+    // receipts. The abbreviated records are enough to add or remove receipts
+    // and to save the box again, so code which only does that should call
+    // this instead of VerifyAccount, and use LoadBoxReceipt or
+    // LoadBoxReceipts to load any receipts which it does need.
+    EXPORT bool VerifyAbbreviated(const Nym& theNym);
     // For ALL abbreviated transactions, load the actual box receipt for each.
     EXPORT bool LoadBoxReceipts(
         std::set<std::int64_t>* psetUnloaded = nullptr);  // if psetUnloaded
@@ -131,6 +137,11 @@ public:
                                                           // in, then use it to
                                                           // return the #s that
                                                           // weren't there.
+    // Loads the box receipts for the listed transactions only, for example a
+    // page of them obtained from GetTransactionNums.
+    EXPORT bool LoadBoxReceipts(
+        const std::set<std::int64_t>& numbers,
+        std::set<std::int64_t>* psetUnloaded = nullptr);
     EXPORT bool SaveBoxReceipts();  // For all "full version" transactions, save
                                     // the actual box receipt for each.
     // Verifies the abbreviated form exists first, and then loads the
@@ -257,6 +268,8 @@ private:  // Private prevents erroneous use by other classes.
         const ledgerType type,
         Identifier& hash,
         bool (Ledger::*calc)(Identifier&) const);
+    // Returns false, and logs, unless this is a known type of ledger
+    bool verify_type(const Nym& theNym) const;
 
     Ledger() = delete;
 };
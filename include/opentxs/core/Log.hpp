@@ -15,6 +15,7 @@
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <fstream>
 #include <iostream>
 #include <mutex>
 #include <thread>
@@ -31,6 +32,15 @@
 
 namespace opentxs
 {
+namespace api
+{
+namespace implementation
+{
+
+class Log;
+
+}  // namespace implementation
+}  // namespace api
 
 typedef std::deque<OTString> dequeOfStrings;
 
@@ -74,13 +84,14 @@ class OTLogStream : public std::ostream, std::streambuf
 {
 private:
     int logLevel{0};
-    int next{0};
-    char* pBuffer{nullptr};
-    std::recursive_mutex lock_;
 
 public:
+    /** Disables the streams which are above the verbosity level, so that
+     *  anything inserted into them is discarded before it is formatted. */
+    static void SetVerbosity(const std::int32_t level);
+
     explicit OTLogStream(int _logLevel);
-    ~OTLogStream();
+    ~OTLogStream() = default;
 
     virtual int overflow(int c) override;
 };
@@ -98,6 +109,7 @@ private:
     bool write_log_file_{false};
     OTString m_strLogFileName;
     OTString m_strLogFilePath;
+    std::ofstream log_file_;
     std::recursive_mutex lock_;
 
     /** For things that represent internal inconsistency in the code. Normally
@@ -168,11 +180,15 @@ public:
 
 private:
     friend OTLogStream;
+    friend LogSource;
+    friend api::implementation::Log;
 
     static void Error(const char* szError);
     static void Output(
         std::int32_t nVerbosity,
         const char* szOutput);  // stdout
+    // Writes to stderr and, if enabled, to the log file, which stays open
+    static bool write(const std::string& text, const bool flush);
 };
 }  // namespace opentxs
 #endif
@@ -9,6 +9,7 @@
 #include "opentxs/Forward.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <sstream>
@@ -18,11 +19,26 @@
 
 namespace opentxs
 {
+namespace api
+{
+namespace implementation
+{
+
+class Log;
+
+}  // namespace implementation
+}  // namespace api
+
+class OTLogStream;
+
 class LogSource
 {
 public:
     static void SetVerbosity(const int level);
     static void Shutdown();
+    /** Called by the log sink once it is bound. Until then, and after
+     *  Shutdown(), lines are written synchronously instead of queued. */
+    static void Start(const network::zeromq::Context& context);
     static const LogSource& StartLog(
         const LogSource& source,
         const std::string& function);
@@ -46,16 +62,31 @@ public:
     ~LogSource() = default;
 
 private:
+    friend OTLogStream;
+    friend api::implementation::Log;
+
     using Source = std::pair<OTZMQPushSocket, std::stringstream>;
 
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
+    static std::atomic<std::uint64_t> generation_;
+    static std::atomic<std::size_t> queued_;
+    static std::atomic<std::uint64_t> dropped_;
     static std::mutex buffer_lock_;
     static std::map<std::thread::id, Source> buffer_;
+    static const network::zeromq::Context* context_;
 
     const int level_{-1};
 
+    static bool consumed();
+    static void dispatch(const int level, std::string&& text);
+    static std::uint64_t dropped();
     static Source& get_buffer(std::string& id);
+    static void send(
+        const OTZMQPushSocket& socket,
+        const int level,
+        std::string&& text,
+        const std::string& id);
 
     LogSource() = delete;
     LogSource(const LogSource&) = delete;
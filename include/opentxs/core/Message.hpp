@@ -112,6 +112,9 @@ public:
 
     EXPORT virtual ~Message();
 
+    /** True if the sender accepts transaction statements which encode
+     *  consecutive numbers as ranges */
+    EXPORT bool AcceptsRanges() const;
     bool VerifyContractID() const override;
 
     EXPORT bool SignContract(
@@ -132,6 +135,9 @@ public:
     // So the message can get the list of numbers from the Nym, before sending,
     // that should be listed as acknowledged that the server reply has already
     // been seen for those request numbers.
+    /** Marks the message as sent by a notary which accepts range encoded
+     *  transaction statements */
+    EXPORT void SetAcceptsRanges();
     EXPORT void SetAcknowledgments(const Context& context);
     EXPORT void SetAcknowledgments(const std::set<RequestNumber>& numbers);
 
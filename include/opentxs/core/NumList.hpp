@@ -8,6 +8,8 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/core/IntervalSet.hpp"
+
 #include <cstdint>
 #include <set>
 #include <string>
@@ -18,10 +20,11 @@ namespace opentxs
  * string, And easily being able to add/remove/verify the individual transaction
  * numbers that are there. (Used by OTTransaction::blank and
  * OTTransaction::successNotice.) Also used in OTMessage, for storing lists of
- * acknowledged request numbers. */
+ * acknowledged request numbers. Consecutive numbers are stored as ranges, but
+ * always serialized as a plain list. */
 class NumList
 {
-    std::set<std::int64_t> m_setData;
+    IntervalSet m_setData;
 
     /** private for security reasons, used internally only by a function that
      * knows the string length already. if false, means the numbers were already
@@ -87,9 +90,11 @@ public:
      * then iterate the output.) returns false if the numlist was empty.*/
     EXPORT bool Output(std::set<std::int64_t>& theOutput) const;
 
-    /** Outputs the numlist as a comma-separated string (for serialization,
-     * usually.) returns false if the numlist was empty. */
+    /** Outputs the numlist as a comma-separated string of numbers (for
+     * serialization, usually.) returns false if the numlist was empty. */
     EXPORT bool Output(String& strOutput) const;
+    /** Iterates the numlist without copying it into a std::set */
+    EXPORT const IntervalSet& Numbers() const;
     EXPORT void Release();
 };
 
@@ -47,6 +47,11 @@ public:
     static const CredentialIndexModeFlag ONLY_IDS = true;
     static const CredentialIndexModeFlag FULL_CREDS = false;
 
+    /** Number of VerifyPseudonym calls answered by a previous result */
+    EXPORT static std::uint64_t VerificationCacheHits();
+    /** Number of VerifyPseudonym calls which checked every signature */
+    EXPORT static std::uint64_t VerificationCacheMisses();
+
     EXPORT bool AddEmail(
         const std::string& value,
         const bool primary,
@@ -224,6 +229,9 @@ public:
 private:
     friend api::implementation::Wallet;
 
+    static std::atomic<std::uint64_t> verification_hits_;
+    static std::atomic<std::uint64_t> verification_misses_;
+
     const api::Core& api_;
     std::int32_t version_{0};
     std::uint32_t index_{0};
@@ -242,6 +250,11 @@ private:
     mapOfCredentialSets m_mapRevokedSets;
     // Revoked child credential IDs
     String::List m_listRevokedIDs;
+    // Credential IDs covered by the most recent verify_pseudonym call, and
+    // its result. Credentials are immutable, so the result stays valid until
+    // the set of IDs changes.
+    mutable std::string verified_index_;
+    mutable bool verified_{false};
 
     template <typename T>
     const crypto::key::Asymmetric& get_private_auth_key(
@@ -267,6 +280,8 @@ private:
         const CredentialIndexModeFlag mode = ONLY_IDS) const;
     bool set_contact_data(const eLock& lock, const proto::ContactData& data);
     bool Verify(const Data& plaintext, const proto::Signature& sig) const;
+    std::string verification_key(const eLock& lock) const;
+    bool verify_credentials(const eLock& lock) const;
     bool verify_pseudonym(const eLock& lock) const;
 
     bool add_contact_credential(
@@ -30,6 +30,9 @@ typedef std::map<std::int64_t, std::shared_ptr<OTCronItem>> mapOfCronItems;
 /** multimapOfCronItems: Mapped to date the item was added to Cron. */
 typedef std::multimap<time64_t, std::shared_ptr<OTCronItem>>
     multimapOfCronItems;
+/** multimapOfCronSchedule: Transaction numbers, mapped to the time at which
+ * the item is next due to be processed. */
+typedef std::multimap<time64_t, std::int64_t> multimapOfCronSchedule;
 /** Mapped (uniquely) to market ID. */
 typedef std::map<std::string, std::shared_ptr<OTMarket>> mapOfMarkets;
 /** Cron stores a bunch of these on this list, which the server refreshes from
@@ -51,6 +54,17 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Position of each item on m_multimapCronItems, by transaction number.
+    std::map<std::int64_t, multimapOfCronItems::iterator> m_mapItemPositions;
+    // Every item is also scheduled by the time it is next due, so each round
+    // only visits the items which actually need processing.
+    multimapOfCronSchedule m_multimapSchedule;
+    std::map<std::int64_t, multimapOfCronSchedule::iterator>
+        m_mapSchedulePositions;
+    // Statistics for the most recent round of ProcessCronItems.
+    std::size_t m_lastRoundProcessed{0};
+    std::size_t m_lastRoundRemoved{0};
+    double m_lastRoundMilliseconds{0};
     // Always store this in any object that's associated with a specific server.
     OTIdentifier m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -71,6 +85,10 @@ private:
 
     static Timer tCron;
 
+    time64_t next_due(const OTCronItem& item, const time64_t& now) const;
+    void schedule_item(const std::int64_t lTransactionNum, const time64_t& due);
+    void unschedule_item(const std::int64_t lTransactionNum);
+
     explicit OTCron(const api::Core& server);
 
     OTCron() = delete;
@@ -155,7 +173,13 @@ public:
      * since it will not be replenished again at least until the call has
      * finished.) */
     void ProcessCronItems();
-
+    /** Items visited, items removed and time spent during the most recent
+     * ProcessCronItems() call. */
+    std::size_t GetLastRoundProcessed() const { return m_lastRoundProcessed; }
+    std::size_t GetLastRoundRemoved() const { return m_lastRoundRemoved; }
+    double GetLastRoundMilliseconds() const { return m_lastRoundMilliseconds; }
+    /** Number of milliseconds until the earliest cron item is due (capped at
+     * GetCronMsBetweenProcess). */
     std::int64_t computeTimeout();
 
     inline void SetNotaryID(const Identifier& NOTARY_ID)
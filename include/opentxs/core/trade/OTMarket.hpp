@@ -47,6 +47,8 @@ class Factory;
 typedef std::multimap<std::int64_t, OTOffer*> mapOfOffers;
 // The same offers are also mapped (uniquely) to transaction number.
 typedef std::map<std::int64_t, OTOffer*> mapOfOffersTrnsNum;
+// Position of each offer on the bid or ask list, by transaction number.
+typedef std::map<std::int64_t, mapOfOffers::iterator> mapOfOfferPositions;
 
 class OTMarket : public Contract
 {
@@ -96,6 +98,9 @@ public:
 
     mapOfOffers::size_type GetBidCount() { return m_mapBids.size(); }
     mapOfOffers::size_type GetAskCount() { return m_mapAsks.size(); }
+    // Incremented whenever the book changes (offer added, removed, or
+    // traded). Trades use it to skip re-matching against an unchanged book.
+    inline std::uint64_t GetRevision() const { return m_lRevision; }
     void SetInstrumentDefinitionID(const Identifier& INSTRUMENT_DEFINITION_ID)
     {
         m_INSTRUMENT_DEFINITION_ID = INSTRUMENT_DEFINITION_ID;
@@ -172,6 +177,11 @@ private:
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
+    mapOfOfferPositions m_mapOfferPositions;  // Where each offer sits on
+                                              // m_mapBids or m_mapAsks.
+    // Starts at 1 so that a trade which has never been matched (revision 0)
+    // is always evaluated.
+    std::uint64_t m_lRevision{1};
 
     OTIdentifier m_NOTARY_ID;  // Always store this in any object that's
                                // associated with a specific server.
@@ -201,6 +201,10 @@ private:
                                          // processed through this order? We
                                          // keep track.
 
+    std::uint64_t marketRevision_{0};  // Market revision at the last matching
+                                       // attempt. Not saved; a restarted
+                                       // server re-evaluates every trade.
+
     OTString marketOffer_;  // The market offer associated with this trade.
 
     EXPORT OTTrade(const api::Core& core);
@@ -11,6 +11,8 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <chrono>
+#include <future>
 #include <string>
 
 namespace opentxs
@@ -32,6 +34,16 @@ public:
     EXPORT virtual NetworkReplyMessage Send(
         const ServerContext& context,
         const Message& message) = 0;
+#ifndef SWIG
+    /** Sends a request without waiting for the reply. Any number of requests
+     *  may be outstanding on the same connection. The future is satisfied by
+     *  the reply which carries the same request number, or with
+     *  SendResult::TIMEOUT once the timeout elapses. */
+    EXPORT virtual std::future<NetworkReplyMessage> SendAsync(
+        const ServerContext& context,
+        const Message& message,
+        const std::chrono::milliseconds& timeout) = 0;
+#endif
     EXPORT virtual bool Status() const = 0;
 
     virtual ~ServerConnection() = default;
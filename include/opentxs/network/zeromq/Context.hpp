@@ -10,8 +10,10 @@
 
 #include "opentxs/network/zeromq/Socket.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef SWIG
 // clang-format off
@@ -20,6 +22,8 @@
 %ignore opentxs::Pimpl<opentxs::network::zeromq::Context>::operator const opentxs::network::zeromq::Context &;
 %ignore opentxs::network::zeromq::Context::operator void*() const;
 %ignore opentxs::network::zeromq::Context::EncodePrivateZ85 const;
+%ignore opentxs::network::zeromq::Context::RegisterReceiver;
+%ignore opentxs::network::zeromq::Context::UnregisterReceiver;
 %rename(assign) operator=(const opentxs::network::zeromq::Context&);
 %rename(ZMQContext) opentxs::network::zeromq::Context;
 %template(OTZMQContext) opentxs::Pimpl<opentxs::network::zeromq::Context>;
@@ -35,6 +39,8 @@ namespace zeromq
 class Context
 {
 public:
+    using ReceiveCallback = std::function<void(void* socket)>;
+
     EXPORT static Pimpl<opentxs::network::zeromq::Context> Factory();
 
     EXPORT static std::string EncodePrivateZ85(
@@ -81,6 +87,14 @@ public:
         const Socket::Direction direction) const = 0;
     EXPORT virtual Pimpl<network::zeromq::PushSocket> PushSocket(
         const Socket::Direction direction) const = 0;
+    /** Poll the sockets on the shared reactor and invoke the callback with
+     *  whichever one has a message waiting. The callback never runs
+     *  concurrently for sockets registered by the same owner. Callbacks share
+     *  a pool of worker threads, so they must not block. */
+    EXPORT virtual bool RegisterReceiver(
+        const void* owner,
+        const std::vector<void*>& sockets,
+        const ReceiveCallback& callback) const = 0;
     EXPORT virtual Pimpl<network::zeromq::ReplySocket> ReplySocket(
         const ReplyCallback& callback,
         const Socket::Direction direction) const = 0;
@@ -91,6 +105,9 @@ public:
         const Socket::Direction direction) const = 0;
     EXPORT virtual Pimpl<network::zeromq::SubscribeSocket> SubscribeSocket(
         const ListenCallback& callback) const = 0;
+    /** Blocks until no callback for this owner is running and its sockets
+     *  are no longer being polled. */
+    EXPORT virtual void UnregisterReceiver(const void* owner) const = 0;
 
     EXPORT virtual ~Context() = default;
 
@@ -81,6 +81,7 @@
 #include <opentxs/core/Cheque.hpp>
 #include <opentxs/core/Data.hpp>
 #include <opentxs/core/Identifier.hpp>
+#include <opentxs/core/IntervalSet.hpp>
 #include <opentxs/core/Ledger.hpp>
 #include <opentxs/core/Log.hpp>
 #include <opentxs/core/LogSource.hpp>
@@ -5,10 +5,29 @@
 
 #include "stdafx.hpp"
 
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/Types.hpp"
 
 namespace opentxs
 {
+bool read_legacy_encoding(
+    const network::zeromq::Message& message,
+    LegacyEncoding& encoding)
+{
+    if (2 != message.Body().size()) { return false; }
+
+    const auto& frame = message.Body().at(1);
+
+    if (sizeof(encoding) != frame.size()) { return false; }
+
+    encoding = *static_cast<const LegacyEncoding*>(frame.data());
+
+    return (LegacyEncoding::ARMORED == encoding) ||
+           (LegacyEncoding::RAW == encoding);
+}
+
 std::string storage_box_name(StorageBox box)
 {
     std::string name = "Unknown";
@@ -6,6 +6,8 @@
 #include "stdafx.hpp"
 
 #include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
@@ -44,10 +46,16 @@ Log::Log(const zmq::Context& zmq)
     const auto started = socket_->Start(LOG_SINK);
 
     if (false == started) { abort(); }
+
+    LogSource::Start(zmq_);
 }
 
 void Log::callback(zmq::Message& message)
 {
+    // Lines are written without flushing while more are queued, so a burst
+    // reaches the file as one batch
+    const bool flush = LogSource::consumed();
+
     if (3 != message.Body().size()) { return; }
 
     int level{-1};
@@ -56,22 +64,36 @@ void Log::callback(zmq::Message& message)
     const auto& id = message.Body_at(2);
     OTPassword::safe_memcpy(
         &level, sizeof(level), levelFrame.data(), levelFrame.size());
+    const auto dropped = LogSource::dropped();
+
 #ifdef ANDROID
+    if (0 < dropped) {
+        print_android(
+            -1, std::to_string(dropped) + " log messages were dropped", id);
+    }
+
     print_android(level, messageFrame, id);
 #else
-    print(level, messageFrame, id);
+    if (0 < dropped) {
+        print(
+            -1,
+            std::to_string(dropped) + " log messages were dropped",
+            id,
+            false);
+    }
+
+    print(level, messageFrame, id, flush);
 #endif
 }
 
 void Log::print(
     const int level,
     const std::string& text,
-    const std::string& thread)
+    const std::string& thread,
+    const bool flush)
 {
     if (false == text.empty()) {
-        std::cerr << "(" << thread << ") ";
-        std::cerr << text << std::endl;
-        std::cerr.flush();
+        opentxs::Log::write("(" + thread + ") " + text + "\n", flush);
     }
 }
 
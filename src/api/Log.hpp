@@ -27,7 +27,8 @@ private:
     void print(
         const int level,
         const std::string& text,
-        const std::string& thread);
+        const std::string& thread,
+        const bool flush);
 #ifdef ANDROID
     void print_android(
         const int level,
@@ -28,12 +28,23 @@
 
 #include "InternalClient.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <list>
 #include <map>
 #include <mutex>
+#include <queue>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "Activity.hpp"
 
+#define MAIL_CACHE_BYTES (16 * 1024 * 1024)
+#define MAX_DECRYPT_THREADS 4
+
 #define OT_METHOD "opentxs::api::implementation::Activity::"
 
 namespace opentxs
@@ -52,11 +63,31 @@ Activity::Activity(const api::Core& api, const client::Contacts& contact)
     : api_(api)
     , contact_(contact)
     , mail_cache_lock_()
+    , mail_order_()
     , mail_cache_()
+    , mail_cache_size_(0)
+    , mail_in_flight_()
+    , mail_hits_(0)
+    , mail_misses_(0)
+    , mail_evictions_(0)
     , publisher_lock_()
     , thread_publishers_()
+    , task_lock_()
+    , task_ready_()
+    , tasks_()
+    , task_sequence_(0)
+    , running_(true)
+    , workers_()
 {
     // WARNING: do not access api_.Wallet() during construction
+    const auto workers = std::max<unsigned int>(
+        1,
+        std::min<unsigned int>(
+            std::thread::hardware_concurrency(), MAX_DECRYPT_THREADS));
+
+    for (unsigned int i = 0; i < workers; ++i) {
+        workers_.emplace_back(&Activity::work, this);
+    }
 }
 
 void Activity::activity_preload_thread(
@@ -68,7 +99,8 @@ void Activity::activity_preload_thread(
 
     for (const auto& it : threads) {
         const auto& threadID = it.first;
-        thread_preload_thread(nymID, threadID, 0, count);
+        thread_preload_thread(
+            nymID, threadID, 0, count, Priority::Background);
     }
 }
 
@@ -147,6 +179,34 @@ bool Activity::AddPaymentEvent(
     return saved;
 }
 
+void Activity::cache_mail(
+    const Lock& lock,
+    const OTIdentifier& id,
+    const MailTextPointer& text) const
+{
+    OT_ASSERT(verify_lock(lock, mail_cache_lock_));
+
+    if (0 < mail_cache_.count(id)) { return; }
+
+    const auto size = text->size();
+
+    while ((false == mail_order_.empty()) &&
+           ((mail_cache_size_ + size) > MAIL_CACHE_BYTES)) {
+        auto it = mail_cache_.find(mail_order_.back());
+
+        OT_ASSERT(mail_cache_.end() != it);
+
+        mail_cache_size_ -= it->second.first->size();
+        mail_cache_.erase(it);
+        mail_order_.pop_back();
+        ++mail_evictions_;
+    }
+
+    mail_order_.push_front(id);
+    mail_cache_.emplace(id, std::make_pair(text, mail_order_.begin()));
+    mail_cache_size_ += size;
+}
+
 Activity::ChequeData Activity::Cheque(
     const Identifier& nym,
     [[maybe_unused]] const std::string& id,
@@ -201,6 +261,53 @@ Activity::ChequeData Activity::Cheque(
     return output;
 }
 
+Activity::MailTextPointer Activity::decrypt_mail(
+    const Identifier& nymID,
+    const Identifier& id,
+    const StorageBox box) const
+{
+    const auto message = Mail(nymID, id, box);
+
+    if (!message) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load message "
+              << String::Factory(id) << std::endl;
+
+        return {};
+    }
+
+    auto nym = api_.Wallet().Nym(nymID);
+
+    if (false == bool(nym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load recipent nym."
+              << std::endl;
+
+        return {};
+    }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Decrypting message " << id.str()
+          << std::endl;
+    auto peerObject = PeerObject::Factory(
+        contact_, api_.Wallet(), nym, message->m_ascPayload);
+    otErr << OT_METHOD << __FUNCTION__ << ": Message " << id.str()
+          << " decrypted." << std::endl;
+
+    if (!peerObject) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to instantiate peer object." << std::endl;
+
+        return {};
+    }
+
+    if (!peerObject->Message()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Peer object does not contain a message." << std::endl;
+
+        return {};
+    }
+
+    return std::make_shared<const std::string>(*peerObject->Message());
+}
+
 const opentxs::network::zeromq::PublishSocket& Activity::get_publisher(
     const Identifier& nymID) const
 {
@@ -335,13 +442,12 @@ std::string Activity::Mail(
         box);
 
     if (saved) {
-        std::thread preload(
-            &Activity::preload,
-            this,
-            Identifier::Factory(nym),
-            Identifier::Factory(id),
-            box);
-        preload.detach();
+        schedule(
+            Priority::Incoming,
+            [this,
+             nymID = Identifier::Factory(nym),
+             mailID = Identifier::Factory(id),
+             box]() -> void { mail_text(nymID, mailID, box); });
         publish(nym, threadID);
 
         return output;
@@ -371,20 +477,51 @@ std::shared_ptr<const std::string> Activity::MailText(
     const Identifier& id,
     const StorageBox& box) const
 {
+    return mail_text(nymID, id, box);
+}
+
+Activity::MailTextPointer Activity::mail_text(
+    const Identifier& nymID,
+    const Identifier& id,
+    const StorageBox box) const
+{
+    const auto key = Identifier::Factory(id);
     Lock lock(mail_cache_lock_);
-    auto it = mail_cache_.find(id);
-    lock.unlock();
+    auto cached = mail_cache_.find(key);
 
-    if (mail_cache_.end() != it) { return it->second; }
+    if (mail_cache_.end() != cached) {
+        auto& [text, position] = cached->second;
+        mail_order_.splice(mail_order_.begin(), mail_order_, position);
+        ++mail_hits_;
 
-    preload(nymID, id, box);
-    lock.lock();
-    it = mail_cache_.find(id);
+        return text;
+    }
+
+    // Another thread is already decrypting this message
+    auto inFlight = mail_in_flight_.find(key);
+
+    if (mail_in_flight_.end() != inFlight) {
+        auto future = inFlight->second;
+        lock.unlock();
+        ++mail_hits_;
+
+        return future.get();
+    }
+
+    ++mail_misses_;
+    std::promise<MailTextPointer> promise{};
+    mail_in_flight_.emplace(key, promise.get_future().share());
     lock.unlock();
+    const auto output = decrypt_mail(nymID, id, box);
+    lock.lock();
+    mail_in_flight_.erase(key);
+
+    if (output) { cache_mail(lock, key, output); }
 
-    if (mail_cache_.end() == it) { return {}; }
+    lock.unlock();
+    promise.set_value(output);
 
-    return it->second;
+    return output;
 }
 
 bool Activity::MarkRead(
@@ -550,65 +687,14 @@ std::shared_ptr<const std::string> Activity::PaymentText(
     return output;
 }
 
-void Activity::preload(
-    const OTIdentifier nymID,
-    const OTIdentifier id,
-    const StorageBox box) const
-{
-    const auto message = Mail(nymID, id, box);
-
-    if (!message) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load message "
-              << String::Factory(id) << std::endl;
-
-        return;
-    }
-
-    auto nym = api_.Wallet().Nym(nymID);
-
-    if (false == bool(nym)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load recipent nym."
-              << std::endl;
-
-        return;
-    }
-
-    otErr << OT_METHOD << __FUNCTION__ << ": Decrypting message " << id->str()
-          << std::endl;
-    auto peerObject = PeerObject::Factory(
-        contact_, api_.Wallet(), nym, message->m_ascPayload);
-    otErr << OT_METHOD << __FUNCTION__ << ": Message " << id->str()
-          << " decrypted." << std::endl;
-
-    if (!peerObject) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Unable to instantiate peer object." << std::endl;
-
-        return;
-    }
-
-    if (!peerObject->Message()) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Peer object does not contain a message." << std::endl;
-
-        return;
-    }
-
-    Lock lock(mail_cache_lock_);
-    auto& output = mail_cache_[id];
-    lock.unlock();
-    output.reset(new std::string(*peerObject->Message()));
-}
-
 void Activity::PreloadActivity(const Identifier& nymID, const std::size_t count)
     const
 {
-    std::thread preload(
-        &Activity::activity_preload_thread,
-        this,
-        Identifier::Factory(nymID),
-        count);
-    preload.detach();
+    schedule(
+        Priority::Background,
+        [this, nym = Identifier::Factory(nymID), count]() -> void {
+            activity_preload_thread(nym, count);
+        });
 }
 
 void Activity::PreloadThread(
@@ -617,11 +703,12 @@ void Activity::PreloadThread(
     const std::size_t start,
     const std::size_t count) const
 {
-    const std::string nym = nymID.str();
-    const std::string thread = threadID.str();
-    std::thread preload(
-        &Activity::thread_preload_thread, this, nym, thread, start, count);
-    preload.detach();
+    schedule(
+        Priority::Visible,
+        [this, nym = nymID.str(), thread = threadID.str(), start, count]()
+            -> void {
+            thread_preload_thread(nym, thread, start, count, Priority::Visible);
+        });
 }
 
 void Activity::publish(const Identifier& nymID, const std::string& threadID)
@@ -631,6 +718,15 @@ void Activity::publish(const Identifier& nymID, const std::string& threadID)
     publisher.Publish(threadID);
 }
 
+void Activity::schedule(const Priority priority, std::function<void()>&& task)
+    const
+{
+    Lock lock(task_lock_);
+    tasks_.push(Task{priority, ++task_sequence_, std::move(task)});
+    lock.unlock();
+    task_ready_.notify_one();
+}
+
 std::shared_ptr<proto::StorageThread> Activity::Thread(
     const Identifier& nymID,
     const Identifier& threadID) const
@@ -646,7 +742,8 @@ void Activity::thread_preload_thread(
     const std::string nymID,
     const std::string threadID,
     const std::size_t start,
-    const std::size_t count) const
+    const std::size_t count,
+    const Priority priority) const
 {
     std::shared_ptr<proto::StorageThread> thread{};
     const bool loaded = api_.Storage().Load(nymID, threadID, thread);
@@ -680,10 +777,12 @@ void Activity::thread_preload_thread(
             case StorageBox::MAILOUTBOX: {
                 otErr << OT_METHOD << __FUNCTION__ << ": Preloading item "
                       << item.id() << " in thread " << threadID << std::endl;
-                MailText(
-                    Identifier::Factory(nymID),
-                    Identifier::Factory(item.id()),
-                    box);
+                schedule(
+                    priority,
+                    [this,
+                     nym = Identifier::Factory(nymID),
+                     mail = Identifier::Factory(item.id()),
+                     box]() -> void { mail_text(nym, mail, box); });
                 ++cached;
             } break;
             default: {
@@ -729,16 +828,37 @@ ObjectList Activity::Threads(const Identifier& nym, const bool unreadOnly) const
 
 std::size_t Activity::UnreadCount(const Identifier& nymId) const
 {
-    const std::string nym = nymId.str();
-    std::size_t output{0};
+    return api_.Storage().UnreadCount(nymId.str());
+}
+
+void Activity::work()
+{
+    while (true) {
+        Lock lock(task_lock_);
+        task_ready_.wait(lock, [this]() -> bool {
+            return (false == running_.load()) || (false == tasks_.empty());
+        });
+
+        if (false == running_.load()) { return; }
+
+        auto task = tasks_.top().run_;
+        tasks_.pop();
+        lock.unlock();
+        task();
+    }
+}
 
-    const auto& threads = api_.Storage().ThreadList(nym, true);
+Activity::~Activity()
+{
+    running_.store(false);
+    task_ready_.notify_all();
 
-    for (const auto& it : threads) {
-        const auto& threadId = it.first;
-        output += api_.Storage().UnreadCount(nym, threadId);
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
     }
 
-    return output;
+    otInfo << OT_METHOD << __FUNCTION__ << ": Mail cache hits: "
+           << mail_hits_.load() << ", misses: " << mail_misses_.load()
+           << ", evictions: " << mail_evictions_.load() << std::endl;
 }
 }  // namespace opentxs::api::client::implementation
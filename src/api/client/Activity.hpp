@@ -174,20 +174,62 @@ public:
 
     std::string ThreadPublisher(const Identifier& nym) const override;
 
-    ~Activity() = default;
+    ~Activity();
 
 private:
     friend opentxs::Factory;
 
-    typedef std::map<OTIdentifier, std::shared_ptr<const std::string>>
-        MailCache;
+    using MailTextPointer = std::shared_ptr<const std::string>;
+    using MailOrder = std::list<OTIdentifier>;
+    using MailCache = std::unordered_map<
+        OTIdentifier,
+        std::pair<MailTextPointer, MailOrder::iterator>>;
+
+    // Decryption tasks are run in priority order, and in submission order
+    // within the same priority
+    enum class Priority : std::uint8_t {
+        Visible = 0,
+        Incoming = 1,
+        Background = 2,
+    };
+
+    struct Task {
+        Priority priority_{Priority::Background};
+        std::uint64_t sequence_{0};
+        std::function<void()> run_{};
+    };
+
+    struct TaskOrder {
+        bool operator()(const Task& lhs, const Task& rhs) const
+        {
+            if (lhs.priority_ != rhs.priority_) {
+                return lhs.priority_ > rhs.priority_;
+            }
+
+            return lhs.sequence_ > rhs.sequence_;
+        }
+    };
 
     const api::Core& api_;
     const client::Contacts& contact_;
     mutable std::mutex mail_cache_lock_;
+    // Most recently used messages are at the front
+    mutable MailOrder mail_order_;
     mutable MailCache mail_cache_;
+    mutable std::size_t mail_cache_size_;
+    mutable std::unordered_map<OTIdentifier, std::shared_future<MailTextPointer>>
+        mail_in_flight_;
+    mutable std::atomic<std::uint64_t> mail_hits_;
+    mutable std::atomic<std::uint64_t> mail_misses_;
+    mutable std::atomic<std::uint64_t> mail_evictions_;
     mutable std::mutex publisher_lock_;
     mutable std::map<OTIdentifier, OTZMQPublishSocket> thread_publishers_;
+    mutable std::mutex task_lock_;
+    mutable std::condition_variable task_ready_;
+    mutable std::priority_queue<Task, std::vector<Task>, TaskOrder> tasks_;
+    mutable std::uint64_t task_sequence_;
+    std::atomic<bool> running_;
+    std::vector<std::thread> workers_;
 
     /**   Migrate nym-based thread IDs to contact-based thread IDs
      *
@@ -197,15 +239,26 @@ private:
     void activity_preload_thread(
         const OTIdentifier nymID,
         const std::size_t count) const;
-    void preload(
-        const OTIdentifier nym,
-        const OTIdentifier id,
+    void cache_mail(
+        const Lock& lock,
+        const OTIdentifier& id,
+        const MailTextPointer& text) const;
+    MailTextPointer decrypt_mail(
+        const Identifier& nym,
+        const Identifier& id,
         const StorageBox box) const;
+    MailTextPointer mail_text(
+        const Identifier& nym,
+        const Identifier& id,
+        const StorageBox box) const;
+    void schedule(const Priority priority, std::function<void()>&& task) const;
     void thread_preload_thread(
         const std::string nymID,
         const std::string threadID,
         const std::size_t start,
-        const std::size_t count) const;
+        const std::size_t count,
+        const Priority priority) const;
+    void work();
 
     std::shared_ptr<const Contact> nym_to_contact(
         const std::string& nymID) const;
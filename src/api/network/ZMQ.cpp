@@ -32,6 +32,7 @@
 #define CLIENT_SEND_TIMEOUT CLIENT_SEND_TIMEOUT_SECONDS
 #define CLIENT_RECV_TIMEOUT CLIENT_RECV_TIMEOUT_SECONDS
 #define KEEP_ALIVE_SECONDS 30
+#define RAW_TRANSPORT true
 
 #define OT_METHOD "opentxs::api::ZMQ::"
 
@@ -54,6 +55,7 @@ ZMQ::ZMQ(const api::Core& api, const Flag& running)
     , receive_timeout_(std::chrono::seconds(CLIENT_RECV_TIMEOUT))
     , send_timeout_(std::chrono::seconds(CLIENT_SEND_TIMEOUT))
     , keep_alive_(std::chrono::seconds(0))
+    , raw_transport_(RAW_TRANSPORT)
     , lock_()
     , socks_proxy_()
     , server_connections_()
@@ -116,6 +118,10 @@ void ZMQ::init(const Lock& lock) const
     api_.Config().CheckSet_long(
         "Connection", "keep_alive", KEEP_ALIVE_SECONDS, keepAlive, notUsed);
     keep_alive_.store(std::chrono::seconds(keepAlive));
+    bool rawTransport{RAW_TRANSPORT};
+    api_.Config().CheckSet_bool(
+        "Connection", "raw_transport", RAW_TRANSPORT, rawTransport, notUsed);
+    raw_transport_.store(rawTransport);
 
     if (configChecked && haveSocksConfig && socks.Exists()) {
         socks_proxy_ = socks.Get();
@@ -17,6 +17,7 @@ public:
     std::chrono::seconds Linger() const override;
     OTZMQContext NewContext() const override;
     std::chrono::seconds ReceiveTimeout() const override;
+    bool RawTransport() const override { return raw_transport_.load(); }
     void RefreshConfig() const override;
     const Flag& Running() const override;
     std::chrono::seconds SendTimeout() const override;
@@ -39,6 +40,7 @@ private:
     mutable std::atomic<std::chrono::seconds> receive_timeout_;
     mutable std::atomic<std::chrono::seconds> send_timeout_;
     mutable std::atomic<std::chrono::seconds> keep_alive_;
+    mutable std::atomic<bool> raw_transport_;
     mutable std::mutex lock_;
     mutable std::string socks_proxy_;
     mutable std::map<std::string, OTServerConnection> server_connections_;
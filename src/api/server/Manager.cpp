@@ -31,14 +31,17 @@
 #include "server/Server.hpp"
 #include "server/ServerSettings.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <deque>
 #include <map>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Manager.hpp"
 
@@ -49,6 +52,9 @@
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
 #define MINT_GENERATE_DAYS 7
+#define MINT_RETRY_SECONDS 60
+#define MINT_KEY_POOL_SIZE 10
+#define MINT_KEY_THREADS 2
 #endif  // OT_CASH
 
 #define OT_METHOD "opentxs::api::server::implementation::Server::"
@@ -92,6 +98,13 @@ Manager::Manager(
     , mint_scan_lock_()
     , mints_()
     , mints_to_check_()
+    , mint_schedule_()
+    , mint_update_cv_()
+    , mint_key_lock_()
+    , mint_key_cv_()
+    , mint_keys_()
+    , mint_key_threads_()
+    , mint_running_(Flag::Factory(true))
 #endif  // OT_CASH
 {
     wallet_.reset(opentxs::Factory::Wallet(*this));
@@ -165,7 +178,9 @@ void Manager::generate_mint(
         return;
     }
 
-    mint->GenerateNewMint(
+    const std::vector<std::int64_t> denominations{
+        1, 5, 10, 25, 100, 500, 1000, 2000, 10000, 100000};
+    const auto generated = mint->GenerateNewMint(
         *wallet_,
         series,
         now,
@@ -174,16 +189,15 @@ void Manager::generate_mint(
         Identifier::Factory(unitID),
         Identifier::Factory(serverID),
         nym,
-        1,
-        5,
-        10,
-        25,
-        100,
-        500,
-        1000,
-        2000,
-        10000,
-        100000);
+        denominations,
+        reserved_keys(denominations.size()));
+
+    if (false == generated) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to generate denomination keys." << std::endl;
+
+        return;
+    }
 
     Lock mintLock(mint_lock_);
 
@@ -396,30 +410,24 @@ void Manager::mint() const
 
     OT_ASSERT(false == serverID.empty());
 
-    while (running_) {
-        Log::Sleep(std::chrono::milliseconds(250));
-
-        if (false == opentxs::server::ServerSettings::__cmd_get_mint) {
-            continue;
-        }
-
-        std::string unitID{""};
+    while (true) {
         updateLock.lock();
-
-        if (0 < mints_to_check_.size()) {
-            unitID = mints_to_check_.back();
-            mints_to_check_.pop_back();
-        }
-
+        const auto unitID = next_mint(updateLock);
         updateLock.unlock();
 
-        if (unitID.empty()) { continue; }
+        if (unitID.empty()) { return; }
 
         const auto last = last_generated_series(serverID, unitID);
         const auto next = last + 1;
+        // Check again shortly after generating, which either schedules the
+        // next series or retries if the new one could not be saved
+        const auto retry = std::time(nullptr) + MINT_RETRY_SECONDS;
 
         if (0 > last) {
             generate_mint(serverID, unitID, 0);
+            updateLock.lock();
+            mint_schedule_[unitID] = retry;
+            updateLock.unlock();
 
             continue;
         }
@@ -441,17 +449,133 @@ void Manager::mint() const
 
         if (generate) {
             generate_mint(serverID, unitID, next);
+            updateLock.lock();
+            mint_schedule_[unitID] = retry;
+            updateLock.unlock();
         } else {
             otErr << OT_METHOD << __FUNCTION__ << ": Existing mint file for "
                   << unitID << " is still valid." << std::endl;
+            updateLock.lock();
+            mint_schedule_[unitID] = expires - limit.count();
+            updateLock.unlock();
+        }
+    }
+}
+
+void Manager::mint_keys() const
+{
+    auto generator = factory_->Mint();
+
+    if (false == bool(generator)) { return; }
+
+    Lock keyLock(mint_key_lock_, std::defer_lock);
+
+    while (true) {
+        keyLock.lock();
+        mint_key_cv_.wait(keyLock, [this]() -> bool {
+            return (false == (running_ && mint_running_.get())) ||
+                   (MINT_KEY_POOL_SIZE > mint_keys_.size());
+        });
+        keyLock.unlock();
+
+        if (false == (running_ && mint_running_.get())) { return; }
+
+        Mint::KeyPair keys{};
+
+        if (false == generator->GenerateKeys(keys)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to generate denomination keys." << std::endl;
+            // Waiting on the condition variable lets the destructor interrupt
+            // the retry delay
+            keyLock.lock();
+            mint_key_cv_.wait_for(
+                keyLock,
+                std::chrono::seconds(MINT_RETRY_SECONDS),
+                [this]() -> bool {
+                    return false == (running_ && mint_running_.get());
+                });
+            keyLock.unlock();
+
+            continue;
+        }
+
+        keyLock.lock();
+        mint_keys_.emplace_back(std::move(keys));
+        keyLock.unlock();
+    }
+}
+#endif  // OT_CASH
+
+#if OT_CASH
+std::string Manager::next_mint(Lock& updateLock) const
+{
+    OT_ASSERT(verify_lock(updateLock, mint_update_lock_));
+
+    while (running_ && mint_running_.get()) {
+        if (false == opentxs::server::ServerSettings::__cmd_get_mint) {
+            mint_update_cv_.wait(updateLock);
+
+            continue;
+        }
+
+        if (0 < mints_to_check_.size()) {
+            const auto output = mints_to_check_.back();
+            mints_to_check_.pop_back();
+
+            return output;
+        }
+
+        const auto now = std::time(nullptr);
+        auto earliest = mint_schedule_.end();
+
+        for (auto it = mint_schedule_.begin(); it != mint_schedule_.end();) {
+            if (it->second <= now) {
+                mints_to_check_.push_front(it->first);
+                it = mint_schedule_.erase(it);
+            } else {
+                if ((mint_schedule_.end() == earliest) ||
+                    (it->second < earliest->second)) {
+                    earliest = it;
+                }
+
+                ++it;
+            }
+        }
+
+        if (0 < mints_to_check_.size()) { continue; }
+
+        if (mint_schedule_.end() == earliest) {
+            mint_update_cv_.wait(updateLock);
+        } else {
+            mint_update_cv_.wait_until(
+                updateLock,
+                std::chrono::system_clock::from_time_t(earliest->second));
         }
     }
+
+    return {};
 }
 #endif  // OT_CASH
 
 const Identifier& Manager::NymID() const { return server_.GetServerNym().ID(); }
 
 #if OT_CASH
+std::vector<Mint::KeyPair> Manager::reserved_keys(const std::size_t count) const
+{
+    Lock keyLock(mint_key_lock_);
+    std::vector<Mint::KeyPair> output{};
+
+    while ((output.size() < count) && (0 < mint_keys_.size())) {
+        output.emplace_back(std::move(mint_keys_.front()));
+        mint_keys_.pop_front();
+    }
+
+    keyLock.unlock();
+    mint_key_cv_.notify_all();
+
+    return output;
+}
+
 void Manager::ScanMints() const
 {
     Lock scanLock(mint_scan_lock_);
@@ -464,6 +588,8 @@ void Manager::ScanMints() const
         mints_to_check_.push_front(id);
         updateLock.unlock();
     }
+
+    mint_update_cv_.notify_all();
 }
 #endif  // OT_CASH
 
@@ -487,6 +613,12 @@ void Manager::Start()
         (proto::ADDRESSTYPE_INPROC == type), port, *privateKey);
     message_processor_.Start();
 #if OT_CASH
+    if (opentxs::server::ServerSettings::__cmd_get_mint) {
+        for (int i = 0; i < MINT_KEY_THREADS; ++i) {
+            mint_key_threads_.emplace_back(&Manager::mint_keys, this);
+        }
+    }
+
     ScanMints();
 #endif  // OT_CASH
 }
@@ -496,6 +628,8 @@ void Manager::UpdateMint(const Identifier& unitID) const
 {
     Lock updateLock(mint_update_lock_);
     mints_to_check_.push_front(unitID.str());
+    updateLock.unlock();
+    mint_update_cv_.notify_all();
 }
 #endif  // OT_CASH
 
@@ -569,6 +703,18 @@ bool Manager::verify_mint_directory(const std::string& serverID) const
 Manager::~Manager()
 {
 #if OT_CASH
+    mint_running_->Off();
+    Lock updateLock(mint_update_lock_);
+    mint_update_cv_.notify_all();
+    updateLock.unlock();
+    Lock keyLock(mint_key_lock_);
+    mint_key_cv_.notify_all();
+    keyLock.unlock();
+
+    for (auto& thread : mint_key_threads_) {
+        if (thread.joinable()) { thread.join(); }
+    }
+
     if (mint_thread_) {
         mint_thread_->join();
         mint_thread_.reset();
@@ -61,6 +61,16 @@ private:
     mutable std::mutex mint_scan_lock_;
     mutable std::map<std::string, MintSeries> mints_;
     mutable std::deque<std::string> mints_to_check_;
+    // Time at which each unit's newest series should be checked again
+    mutable std::map<std::string, std::time_t> mint_schedule_;
+    mutable std::condition_variable mint_update_cv_;
+    // Unsealed key pairs generated ahead of time for the next new series.
+    // They are only ever held in memory.
+    mutable std::mutex mint_key_lock_;
+    mutable std::condition_variable mint_key_cv_;
+    mutable std::deque<Mint::KeyPair> mint_keys_;
+    std::vector<std::thread> mint_key_threads_;
+    OTFlag mint_running_;
 #endif  // OT_CASH
 
 #if OT_CASH
@@ -83,6 +93,9 @@ private:
         const std::string& unitID,
         const std::string seriesID) const;
     void mint() const;
+    void mint_keys() const;
+    std::string next_mint(Lock& updateLock) const;
+    std::vector<Mint::KeyPair> reserved_keys(const std::size_t count) const;
 #endif  // OT_CASH
     bool verify_lock(const Lock& lock, const std::mutex& mutex) const;
 #if OT_CASH
@@ -39,10 +39,13 @@
 #include "StorageInternal.hpp"
 
 #include <cassert>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <list>
@@ -153,6 +156,30 @@ api::storage::StorageInternal* Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "commit_window",
+        storageConfig.commit_window_,
+        storageConfig.commit_window_,
+        notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "gc_threads",
+        storageConfig.gc_threads_,
+        storageConfig.gc_threads_,
+        notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "gc_rate",
+        storageConfig.gc_rate_,
+        storageConfig.gc_rate_,
+        notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "cache_size",
+        storageConfig.cache_size_,
+        storageConfig.cache_size_,
+        notUsed);
     config.CheckSet_str(
         STORAGE_CONFIG_KEY,
         "path",
@@ -193,6 +220,24 @@ api::storage::StorageInternal* Factory::Storage(
         notUsed);
     encryptedDirectory =
         String(storageConfig.fs_encrypted_backup_directory_.c_str());
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "fs_shard_levels",
+        storageConfig.fs_shard_levels_,
+        storageConfig.fs_shard_levels_,
+        notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "fs_shard_width",
+        storageConfig.fs_shard_width_,
+        storageConfig.fs_shard_width_,
+        notUsed);
+    config.CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        "fs_durability",
+        storageConfig.fs_durability_,
+        storageConfig.fs_durability_,
+        notUsed);
 #endif
 #if OT_STORAGE_SQLITE
     config.CheckSet_str(
@@ -276,8 +321,21 @@ Storage::Storage(
           hash,
           random))
     , multiplex_(*multiplex_p_)
+    , commit_window_(std::max<std::int64_t>(config_.commit_window_, 0))
+    , commit_lock_()
+    , commit_cv_()
+    , batch_depth_(0)
+    , commit_running_(true)
+    , commit_promise_(nullptr)
+    , commit_future_()
+    , commit_deadline_()
+    , commit_thread_()
 {
     OT_ASSERT(multiplex_p_);
+
+    if (0 < commit_window_.count()) {
+        commit_thread_ = std::thread(&Storage::commit_periodically, this);
+    }
 }
 
 ObjectList Storage::AccountList() const
@@ -344,6 +402,12 @@ std::set<OTIdentifier> Storage::AccountsByUnit(
     return Root().Tree().AccountNode().AccountsByUnit(unit);
 }
 
+void Storage::BeginBatch() const
+{
+    Lock lock(commit_lock_);
+    ++batch_depth_;
+}
+
 OTIdentifier Storage::Bip47AddressToChannel(
     const Identifier& nymID,
     const std::string& address) const
@@ -573,6 +637,19 @@ void Storage::Cleanup_Storage()
         if (thread.joinable()) { thread.join(); }
     }
 
+    Lock commitLock(commit_lock_);
+    commit_running_ = false;
+    batch_depth_ = 0;
+    commitLock.unlock();
+    commit_cv_.notify_all();
+
+    if (commit_thread_.joinable()) { commit_thread_.join(); }
+
+    Lock lock(write_lock_);
+    commitLock.lock();
+    commit(lock, commitLock);
+    lock.unlock();
+
     if (root_) { root_->cleanup(); }
 }
 
@@ -580,6 +657,58 @@ void Storage::Cleanup() { Cleanup_Storage(); }
 
 void Storage::CollectGarbage() const { Root().Migrate(multiplex_.Primary()); }
 
+std::shared_future<bool> Storage::commit(const Lock& lock, Lock& commitLock)
+    const
+{
+    OT_ASSERT(verify_write_lock(lock));
+    OT_ASSERT(commitLock.owns_lock());
+
+    if (false == bool(commit_promise_)) {
+        commitLock.unlock();
+
+        return Durable();
+    }
+
+    auto promise = commit_promise_;
+    auto future = commit_future_;
+    commit_promise_.reset();
+    commitLock.unlock();
+
+    OT_ASSERT(root_);
+
+    // Every write which has completed so far is reachable from the current
+    // root, so committing it makes the whole group durable at once
+    promise->set_value(multiplex_.StoreRoot(true, root_->Root()));
+
+    return future;
+}
+
+void Storage::commit_periodically() const
+{
+    Lock commitLock(commit_lock_);
+
+    while (commit_running_) {
+        if ((false == bool(commit_promise_)) || (0 < batch_depth_)) {
+            commit_cv_.wait(commitLock);
+
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() < commit_deadline_) {
+            commit_cv_.wait_until(commitLock, commit_deadline_);
+
+            continue;
+        }
+
+        commitLock.unlock();
+        Lock lock(write_lock_);
+        commitLock.lock();
+        commit(lock, commitLock);
+        lock.unlock();
+        commitLock.lock();
+    }
+}
+
 std::string Storage::ContactAlias(const std::string& id) const
 {
     return Root().Tree().ContactNode().Alias(id);
@@ -683,6 +812,45 @@ bool Storage::DeletePaymentWorkflow(
         .Delete(workflowID);
 }
 
+std::shared_future<bool> Storage::Durable() const
+{
+    Lock lock(commit_lock_);
+
+    if (commit_future_.valid()) { return commit_future_; }
+
+    std::promise<bool> promise{};
+    promise.set_value(true);
+
+    return promise.get_future();
+}
+
+std::shared_future<bool> Storage::EndBatch() const
+{
+    Lock commitLock(commit_lock_);
+
+    if (0 == batch_depth_) {
+        otErr << OT_METHOD << __FUNCTION__ << ": No batch in progress."
+              << std::endl;
+        commitLock.unlock();
+
+        return Durable();
+    }
+
+    --batch_depth_;
+
+    if (0 < batch_depth_) {
+        commitLock.unlock();
+
+        return Durable();
+    }
+
+    commitLock.unlock();
+    Lock lock(write_lock_);
+    commitLock.lock();
+
+    return commit(lock, commitLock);
+}
+
 std::uint32_t Storage::HashType() const { return HASH_TYPE; }
 
 void Storage::InitBackup() { multiplex_.InitBackup(); }
@@ -703,6 +871,8 @@ void Storage::InitPlugins()
         multiplex_,
         hash,
         std::numeric_limits<std::int64_t>::max(),
+        1,
+        0,
         primary_bucket_)};
 
     OT_ASSERT(root);
@@ -1079,7 +1249,12 @@ opentxs::storage::Root* Storage::root() const
 
     if (!root_) {
         root_.reset(new opentxs::storage::Root(
-            multiplex_, multiplex_.LoadRoot(), gc_interval_, primary_bucket_));
+            multiplex_,
+            multiplex_.LoadRoot(),
+            gc_interval_,
+            std::max<std::int64_t>(config_.gc_threads_, 1),
+            std::max<std::int64_t>(config_.gc_rate_, 0),
+            primary_bucket_));
     }
 
     OT_ASSERT(root_);
@@ -1593,7 +1768,28 @@ void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
 
-    multiplex_.StoreRoot(true, in->root_);
+    Lock commitLock(commit_lock_);
+    const bool defer = (0 < batch_depth_) || (0 < commit_window_.count());
+
+    if ((false == defer) && (false == bool(commit_promise_))) {
+        commitLock.unlock();
+        multiplex_.StoreRoot(true, in->root_);
+
+        return;
+    }
+
+    if (false == bool(commit_promise_)) {
+        commit_promise_ = std::make_shared<std::promise<bool>>();
+        commit_future_ = commit_promise_->get_future();
+        commit_deadline_ = std::chrono::steady_clock::now() + commit_window_;
+    }
+
+    if (defer) {
+        commitLock.unlock();
+        commit_cv_.notify_all();
+    } else {
+        commit(lock, commitLock);
+    }
 }
 
 bool Storage::SetContactAlias(const std::string& id, const std::string& alias)
@@ -2230,6 +2426,20 @@ ObjectList Storage::UnitDefinitionList() const
     return Root().Tree().UnitNode().List();
 }
 
+std::size_t Storage::UnreadCount(const std::string& nymId) const
+{
+    auto& nyms = Root().Tree().NymNode();
+
+    if (false == nyms.Exists(nymId)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Nym " << nymId
+              << " does not exist." << std::endl;
+
+        return 0;
+    }
+
+    return nyms.Nym(nymId).Threads().UnreadCount();
+}
+
 std::size_t Storage::UnreadCount(
     const std::string& nymId,
     const std::string& threadId) const
@@ -2252,7 +2462,7 @@ std::size_t Storage::UnreadCount(
         return 0;
     }
 
-    return threads.Thread(threadId).UnreadCount();
+    return threads.UnreadCount(threadId);
 }
 
 void Storage::UpgradeNyms()
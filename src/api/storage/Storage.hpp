@@ -51,6 +51,7 @@ public:
         const Identifier& server) const override;
     std::set<OTIdentifier> AccountsByUnit(
         const proto::ContactItemType unit) const override;
+    void BeginBatch() const override;
     OTIdentifier Bip47AddressToChannel(
         const Identifier& nymID,
         const std::string& address) const override;
@@ -102,6 +103,8 @@ public:
     bool DeletePaymentWorkflow(
         const std::string& nymID,
         const std::string& workflowID) const override;
+    std::shared_future<bool> Durable() const override;
+    std::shared_future<bool> EndBatch() const override;
     std::uint32_t HashType() const override;
     ObjectList IssuerList(const std::string& nymID) const override;
     bool Load(
@@ -342,6 +345,7 @@ public:
         const std::string& threadID) const override;
     std::string UnitDefinitionAlias(const std::string& id) const override;
     ObjectList UnitDefinitionList() const override;
+    std::size_t UnreadCount(const std::string& nymId) const override;
     std::size_t UnreadCount(
         const std::string& nymId,
         const std::string& threadId) const override;
@@ -363,6 +367,16 @@ private:
     const StorageConfig config_;
     std::unique_ptr<Multiplex> multiplex_p_;
     Multiplex& multiplex_;
+    const std::chrono::milliseconds commit_window_;
+    mutable std::mutex commit_lock_;
+    mutable std::condition_variable commit_cv_;
+    mutable std::size_t batch_depth_{0};
+    mutable bool commit_running_{true};
+    // Set while the current root has not been committed
+    mutable std::shared_ptr<std::promise<bool>> commit_promise_;
+    mutable std::shared_future<bool> commit_future_;
+    mutable std::chrono::steady_clock::time_point commit_deadline_;
+    std::thread commit_thread_;
 
     opentxs::storage::Root* root() const;
     const opentxs::storage::Root& Root() const;
@@ -371,6 +385,8 @@ private:
     void Cleanup();
     void Cleanup_Storage();
     void CollectGarbage() const;
+    std::shared_future<bool> commit(const Lock& lock, Lock& commitLock) const;
+    void commit_periodically() const;
     void InitBackup() override;
     void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) override;
     void InitPlugins();
@@ -10,6 +10,7 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/cash/MintLucre.hpp"
+#include "opentxs/core/crypto/OTEnvelope.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/OTFolders.hpp"
@@ -26,13 +27,17 @@
 
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -709,6 +714,45 @@ void Mint::GenerateNewMint(
     std::int64_t nDenom8,
     std::int64_t nDenom9,
     std::int64_t nDenom10)
+{
+    std::vector<std::int64_t> denominations{};
+
+    for (const auto& denomination : {nDenom1,
+                                     nDenom2,
+                                     nDenom3,
+                                     nDenom4,
+                                     nDenom5,
+                                     nDenom6,
+                                     nDenom7,
+                                     nDenom8,
+                                     nDenom9,
+                                     nDenom10}) {
+        if (denomination) { denominations.emplace_back(denomination); }
+    }
+
+    GenerateNewMint(
+        wallet,
+        nSeries,
+        VALID_FROM,
+        VALID_TO,
+        MINT_EXPIRATION,
+        theInstrumentDefinitionID,
+        theNotaryID,
+        theNotary,
+        denominations);
+}
+
+bool Mint::GenerateNewMint(
+    const api::Wallet& wallet,
+    std::int32_t nSeries,
+    time64_t VALID_FROM,
+    time64_t VALID_TO,
+    time64_t MINT_EXPIRATION,
+    const Identifier& theInstrumentDefinitionID,
+    const Identifier& theNotaryID,
+    const Nym& theNotary,
+    const std::vector<std::int64_t>& denominations,
+    std::vector<KeyPair>&& keys)
 {
     Release();
 
@@ -739,56 +783,136 @@ void Mint::GenerateNewMint(
 
     account.Release();
 
-    if (nDenom1) {
-        AddDenomination(
-            theNotary,
-            nDenom1);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom2) {
-        AddDenomination(
-            theNotary,
-            nDenom2);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom3) {
-        AddDenomination(
-            theNotary,
-            nDenom3);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom4) {
-        AddDenomination(
-            theNotary,
-            nDenom4);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom5) {
-        AddDenomination(
-            theNotary,
-            nDenom5);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom6) {
-        AddDenomination(
-            theNotary,
-            nDenom6);  // std::int32_t nPrimeLength default = 1024
+    // Each denomination needs its own large prime search, which is by far
+    // the slowest part of creating a mint, so any key pairs which were not
+    // supplied by the caller are generated on as many cores as are available
+    const auto supplied = std::min(keys.size(), denominations.size());
+    const auto missing = denominations.size() - supplied;
+    keys.resize(denominations.size());
+    std::atomic<std::size_t> next{supplied};
+    auto worker = [&]() -> void {
+        for (auto i = next++; i < keys.size(); i = next++) {
+            if (false == GenerateKeys(keys.at(i))) { keys.at(i) = {}; }
+        }
+    };
+    const auto workers = std::min<std::size_t>(
+        missing, std::max(std::thread::hardware_concurrency(), 1u));
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i = 1; i < workers; ++i) { threads.emplace_back(worker); }
+
+    worker();
+
+    for (auto& thread : threads) { thread.join(); }
+
+    bool output{true};
+
+    for (std::size_t i = 0; i < denominations.size(); ++i) {
+        const auto& denomination = denominations.at(i);
+        const auto& pair = keys.at(i);
+
+        if (pair.first.empty() || pair.second.empty() ||
+            (false == SetDenominationKeys(theNotary, denomination, pair))) {
+            otErr << __FUNCTION__ << ": Failed to add denomination "
+                  << denomination << "\n";
+            output = false;
+        }
     }
-    if (nDenom7) {
-        AddDenomination(
-            theNotary,
-            nDenom7);  // std::int32_t nPrimeLength default = 1024
+
+    return output;
+}
+
+bool Mint::SetDenominationKeys(
+    const Nym& theNotary,
+    std::int64_t lDenomination,
+    const KeyPair& keys)
+{
+    // Let's make sure it doesn't already exist
+    Armored theArmor;
+    if (GetPublic(theArmor, lDenomination)) {
+        otErr << "Error: Denomination public already exists in "
+                 "Mint::SetDenominationKeys\n";
+        return false;
     }
-    if (nDenom8) {
-        AddDenomination(
-            theNotary,
-            nDenom8);  // std::int32_t nPrimeLength default = 1024
+    if (GetPrivate(theArmor, lDenomination)) {
+        otErr << "Error: Denomination private already exists in "
+                 "Mint::SetDenominationKeys\n";
+        return false;
     }
-    if (nDenom9) {
-        AddDenomination(
-            theNotary,
-            nDenom9);  // std::int32_t nPrimeLength default = 1024
+
+    auto strPrivateBank = String::Factory(keys.first);
+    auto strPublicBank = String::Factory(keys.second);
+
+    Armored* pPublic = new Armored;
+    Armored* pPrivate = new Armored;
+
+    OT_ASSERT(nullptr != pPublic);
+    OT_ASSERT(nullptr != pPrivate);
+
+    // Set the public bank info onto pPublic
+    pPublic->SetString(strPublicBank, true);  // linebreaks = true
+
+    // Seal the private bank info up into an encrypted Envelope
+    // and set it onto pPrivate
+    OTEnvelope theEnvelope;
+    theEnvelope.Seal(theNotary, strPrivateBank);  // Todo check the return
+                                                  // values on these two
+                                                  // functions
+    theEnvelope.GetCiphertext(*pPrivate);
+
+    // Add the new key pair to the maps, using denomination as the key
+    m_mapPublic[lDenomination] = pPublic;
+    m_mapPrivate[lDenomination] = pPrivate;
+
+    // Grab the Server Nym ID and save it with this Mint
+    theNotary.GetIdentifier(m_ServerNymID);
+    m_nDenominationCount++;
+    otWarn << "Successfully added denomination: " << lDenomination << "\n";
+
+    return true;
+}
+
+bool Mint::SignTokens(
+    const Nym& theNotary,
+    const std::vector<Token*>& tokens,
+    std::vector<std::string>& signatures,
+    std::int32_t nTokenIndex)
+{
+    bool output{true};
+    signatures.assign(tokens.size(), {});
+
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        OT_ASSERT(nullptr != tokens.at(i));
+
+        auto signature = String::Factory();
+
+        if (SignToken(
+                theNotary, *tokens.at(i), signature.get(), nTokenIndex)) {
+            signatures.at(i) = signature->Get();
+        } else {
+            output = false;
+        }
     }
-    if (nDenom10) {
-        AddDenomination(
-            theNotary,
-            nDenom10);  // std::int32_t nPrimeLength default = 1024
+
+    return output;
+}
+
+bool Mint::VerifyTokens(
+    const Nym& theNotary,
+    const std::vector<std::pair<std::string, std::int64_t>>& tokens,
+    std::vector<bool>& verified)
+{
+    bool output{true};
+    verified.assign(tokens.size(), false);
+
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        auto cleartext = String::Factory(tokens.at(i).first);
+        verified.at(i) =
+            VerifyToken(theNotary, cleartext.get(), tokens.at(i).second);
+        output &= verified.at(i);
     }
+
+    return output;
 }
 
 Mint::~Mint() { Release_Mint(); }
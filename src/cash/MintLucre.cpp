@@ -17,6 +17,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/Types.hpp"
 
 #if OT_CASH_USING_LUCRE
 #include "crypto/library/OpenSSL_BIO.hpp"
@@ -27,7 +28,16 @@
 #include <openssl/ossl_typ.h>
 #include <stdio.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #ifdef __APPLE__
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -40,6 +50,8 @@ namespace opentxs
 
 MintLucre::MintLucre(const api::Core& core)
     : ot_super(core)
+    , bank_lock_()
+    , private_banks_()
 {
 }
 
@@ -48,6 +60,8 @@ MintLucre::MintLucre(
     const String& strNotaryID,
     const String& strInstrumentDefinitionID)
     : ot_super(core, strNotaryID, strInstrumentDefinitionID)
+    , bank_lock_()
+    , private_banks_()
 {
 }
 
@@ -57,6 +71,8 @@ MintLucre::MintLucre(
     const String& strServerNymID,
     const String& strInstrumentDefinitionID)
     : ot_super(core, strNotaryID, strServerNymID, strInstrumentDefinitionID)
+    , bank_lock_()
+    , private_banks_()
 {
 }
 
@@ -67,9 +83,7 @@ bool MintLucre::AddDenomination(
     std::int64_t lDenomination,
     std::int32_t nPrimeLength)
 {
-    bool bReturnValue = false;
-
-    // Let's make sure it doesn't already exist
+    // Let's make sure it doesn't already exist before generating a key
     Armored theArmor;
     if (GetPublic(theArmor, lDenomination)) {
         otErr << "Error: Denomination public already exists in "
@@ -82,6 +96,15 @@ bool MintLucre::AddDenomination(
         return false;
     }
 
+    KeyPair keys{};
+
+    if (false == GenerateKeys(keys, nPrimeLength)) { return false; }
+
+    return SetDenominationKeys(theNotary, lDenomination, keys);
+}
+
+bool MintLucre::GenerateKeys(KeyPair& keys, std::int32_t nPrimeLength) const
+{
     if ((nPrimeLength / 8) < (MIN_COIN_LENGTH + DIGEST_LENGTH)) {
         otErr << "Prime must be at least "
               << (MIN_COIN_LENGTH + DIGEST_LENGTH) * 8 << " bits\n";
@@ -93,13 +116,18 @@ bool MintLucre::AddDenomination(
         return false;
     }
 
+    // The monitor is global to Lucre, so it is only set once even when
+    // several denominations are being generated at the same time
+    static std::once_flag monitor;
+    std::call_once(monitor, []() {
 #ifdef _WIN32
-    BIO* out = BIO_new_file("openssl.dump", "w");
-    assert(out);
-    SetDumper(out);
+        BIO* out = BIO_new_file("openssl.dump", "w");
+        assert(out);
+        SetDumper(out);
 #else
-    SetMonitor(stderr);
+        SetMonitor(stderr);
 #endif
+    });
 
     crypto::implementation::OpenSSL_BIO bio = BIO_new(BIO_s_mem());
     crypto::implementation::OpenSSL_BIO bioPublic = BIO_new(BIO_s_mem());
@@ -112,7 +140,7 @@ bool MintLucre::AddDenomination(
     PublicBank pbank(bank);
     pbank.WriteBIO(bioPublic);
 
-    // Copy from BIO back to a normal OTString or Ascii-Armor
+    // Copy from BIO back to a normal string
     char privateBankBuffer[4096],
         publicBankBuffer[4096];  // todo stop hardcoding these string lengths
     std::int32_t privatebankLen =
@@ -123,46 +151,63 @@ bool MintLucre::AddDenomination(
         publicBankBuffer,
         4000);  // Just makes me feel more comfortable for some reason.
 
-    if (privatebankLen && publicbankLen) {
-        // With this, we have the Lucre public and private bank info converted
-        // to OTStrings
-        auto strPublicBank = String::Factory();
-        strPublicBank->Set(publicBankBuffer, publicbankLen);
-        auto strPrivateBank = String::Factory();
-        strPrivateBank->Set(privateBankBuffer, privatebankLen);
-
-        Armored* pPublic = new Armored;
-        Armored* pPrivate = new Armored;
-
-        OT_ASSERT(nullptr != pPublic);
-        OT_ASSERT(nullptr != pPrivate);
-
-        // Set the public bank info onto pPublic
-        pPublic->SetString(strPublicBank, true);  // linebreaks = true
-
-        // Seal the private bank info up into an encrypted Envelope
-        // and set it onto pPrivate
-        OTEnvelope theEnvelope;
-        theEnvelope.Seal(theNotary, strPrivateBank);  // Todo check the return
-                                                      // values on these two
-                                                      // functions
-        theEnvelope.GetCiphertext(*pPrivate);
-
-        // Add the new key pair to the maps, using denomination as the key
-        m_mapPublic[lDenomination] = pPublic;
-        m_mapPrivate[lDenomination] = pPrivate;
-
-        // Grab the Server Nym ID and save it with this Mint
-        theNotary.GetIdentifier(m_ServerNymID);
-        m_nDenominationCount++;
-        bReturnValue = true;
-        otWarn << "Successfully added denomination: " << lDenomination << "\n";
+    if ((0 < privatebankLen) && (0 < publicbankLen)) {
+        keys.first.assign(privateBankBuffer, privatebankLen);
+        keys.second.assign(publicBankBuffer, publicbankLen);
+
+        return true;
     }
 
-    return bReturnValue;
+    return false;
 }
 
 #if OT_CRYPTO_USING_OPENSSL
+namespace
+{
+using Banks = std::map<std::int64_t, std::unique_ptr<Bank>>;
+
+// Each thread needs its own Bank since a Bank carries its own BN_CTX
+Bank* get_bank(
+    Banks& banks,
+    const std::map<std::int64_t, std::string>& keys,
+    const std::int64_t denomination)
+{
+    auto it = banks.find(denomination);
+
+    if (banks.end() != it) { return it->second.get(); }
+
+    const auto key = keys.find(denomination);
+
+    if (keys.end() == key) { return nullptr; }
+
+    crypto::implementation::OpenSSL_BIO bioBank = BIO_new(BIO_s_mem());
+    BIO_puts(bioBank, key->second.c_str());
+    auto& output = banks[denomination];
+    output.reset(new Bank(bioBank));
+
+    return output.get();
+}
+
+template <typename Job>
+void parallel(const std::size_t count, const Job& job)
+{
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() -> void {
+        Banks banks{};
+
+        for (auto i = next++; i < count; i = next++) { job(banks, i); }
+    };
+    const auto workers = std::min<std::size_t>(
+        count, std::max(std::thread::hardware_concurrency(), 1u));
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i = 1; i < workers; ++i) { threads.emplace_back(worker); }
+
+    worker();
+
+    for (auto& thread : threads) { thread.join(); }
+}
+}  // namespace
 
 // Lucre step 3: the mint signs the token
 //
@@ -172,34 +217,111 @@ bool MintLucre::SignToken(
     String& theOutput,
     std::int32_t nTokenIndex)
 {
-    bool bReturnValue = false;
+    LucreDumper setDumper;
+    std::map<std::int64_t, std::string> keys{};
 
+    if (false == private_bank(theNotary, theToken.GetDenomination(), keys)) {
+        return false;
+    }
+
+    Banks banks{};
+    auto* bank = get_bank(banks, keys, theToken.GetDenomination());
+
+    if (nullptr == bank) { return false; }
+
+    return sign(*bank, theToken, theOutput, nTokenIndex);
+}
+
+bool MintLucre::SignTokens(
+    const Nym& theNotary,
+    const std::vector<Token*>& tokens,
+    std::vector<std::string>& signatures,
+    std::int32_t nTokenIndex)
+{
     LucreDumper setDumper;
+    std::map<std::int64_t, std::string> keys{};
+    signatures.assign(tokens.size(), {});
 
-    crypto::implementation::OpenSSL_BIO bioBank =
-        BIO_new(BIO_s_mem());  // input
-    crypto::implementation::OpenSSL_BIO bioRequest =
-        BIO_new(BIO_s_mem());  // input
-    crypto::implementation::OpenSSL_BIO bioSignature =
-        BIO_new(BIO_s_mem());  // output
+    // Opening the envelopes uses the notary nym, so this part stays on the
+    // calling thread
+    for (const auto* token : tokens) {
+        OT_ASSERT(nullptr != token);
+
+        private_bank(theNotary, token->GetDenomination(), keys);
+    }
+
+    parallel(tokens.size(), [&](Banks& banks, const std::size_t i) -> void {
+        auto& token = *tokens.at(i);
+        auto* bank = get_bank(banks, keys, token.GetDenomination());
 
-    Armored thePrivate;
-    GetPrivate(thePrivate, theToken.GetDenomination());
+        if (nullptr == bank) { return; }
+
+        auto output = String::Factory();
+
+        if (sign(*bank, token, output.get(), nTokenIndex)) {
+            signatures.at(i) = output->Get();
+        }
+    });
+
+    for (const auto& signature : signatures) {
+        if (signature.empty()) { return false; }
+    }
+
+    return true;
+}
+
+bool MintLucre::private_bank(
+    const Nym& theNotary,
+    const std::int64_t lDenomination,
+    std::map<std::int64_t, std::string>& output)
+{
+    if (0 < output.count(lDenomination)) { return true; }
 
-    // The Mint private info is encrypted in
-    // m_mapPrivates[theToken.GetDenomination()].
+    // The Mint private info is encrypted in m_mapPrivate[lDenomination].
     // So I need to extract that first before I can use it.
-    OTEnvelope theEnvelope(thePrivate);
+    Armored theArmor;
+
+    if (false == GetPrivate(theArmor, lDenomination)) { return false; }
+
+    const std::string ciphertext{theArmor.Get()};
+    Lock lock(bank_lock_);
+    auto it = private_banks_.find(lDenomination);
+
+    // The ciphertext is compared so that a stale entry is never used if the
+    // mint is reloaded or regenerated
+    if ((private_banks_.end() != it) && (it->second.first == ciphertext)) {
+        output[lDenomination] = it->second.second;
+
+        return true;
+    }
 
+    lock.unlock();
+    OTEnvelope theEnvelope(theArmor);
     auto strContents = String::Factory();  // output from opening the envelope.
+
     // Decrypt the Envelope into strContents
-    if (!theEnvelope.Open(theNotary, strContents)) return false;
+    if (false == theEnvelope.Open(theNotary, strContents)) { return false; }
 
-    // copy strContents to a BIO
-    BIO_puts(bioBank, strContents->Get());
+    const std::string plaintext{strContents->Get()};
+    lock.lock();
+    private_banks_[lDenomination] = {ciphertext, plaintext};
+    output[lDenomination] = plaintext;
 
-    // Instantiate the Bank with its private key
-    Bank bank(bioBank);
+    return true;
+}
+
+bool MintLucre::sign(
+    Bank& bank,
+    Token& theToken,
+    String& theOutput,
+    std::int32_t nTokenIndex) const
+{
+    bool bReturnValue = false;
+
+    crypto::implementation::OpenSSL_BIO bioRequest =
+        BIO_new(BIO_s_mem());  // input
+    crypto::implementation::OpenSSL_BIO bioSignature =
+        BIO_new(BIO_s_mem());  // output
 
     // I need the request. the prototoken.
     Armored ascPrototoken;
@@ -244,20 +366,16 @@ bool MintLucre::SignToken(
                         // makes me feel more comfortable
                         // for some reason.
 
-            // Add the null terminator by hand (just in case.)
-            sig_buf[sig_len] = '\0';
+            if (0 < sig_len) {
+                // Add the null terminator by hand (just in case.)
+                sig_buf[sig_len] = '\0';
 
-            if (sig_len) {
                 // Copy the original coin request into the spendable field of
                 // the token object.
                 // (It won't actually be spendable until the client processes
                 // it, though.)
                 theToken.SetSpendable(ascPrototoken);
 
-                // Base64-encode the signature contents into
-                // theToken.m_Signature.
-                auto strSignature = String::Factory(sig_buf);
-
                 // Here we pass the signature back to the caller.
                 // He will probably set it onto the token.
                 theOutput.Set(sig_buf, sig_len);
@@ -276,6 +394,25 @@ bool MintLucre::SignToken(
     return bReturnValue;
 }
 
+bool MintLucre::verify(Bank& bank, const std::string& theCleartextToken) const
+{
+    crypto::implementation::OpenSSL_BIO bioCoin =
+        BIO_new(BIO_s_mem());  // input
+
+    // --- copy theCleartextToken to bioCoin so lucre can load it
+    BIO_puts(bioCoin, theCleartextToken.c_str());
+    Coin coin(bioCoin);
+
+    // Here's the boolean output: coin is verified!
+    //
+    // (done): When a token is redeemed, need to store it in the spent token
+    // database, and make sure the issuer has double-entries for the total
+    // amount outstanding. The Spent Token database is implemented in the
+    // transaction server, (not OTLib proper) and the same server also keeps a
+    // cash account to match all cash withdrawals.
+    return bank.Verify(coin);
+}
+
 // Lucre step 5: mint verifies token when it is redeemed by merchant.
 // This function is called by OTToken::VerifyToken.
 // That's the one you should be calling, most likely, not this one.
@@ -284,68 +421,52 @@ bool MintLucre::VerifyToken(
     String& theCleartextToken,
     std::int64_t lDenomination)
 {
-    bool bReturnValue = false;
     LucreDumper setDumper;
+    std::map<std::int64_t, std::string> keys{};
 
-    crypto::implementation::OpenSSL_BIO bioBank =
-        BIO_new(BIO_s_mem());  // input
-    crypto::implementation::OpenSSL_BIO bioCoin =
-        BIO_new(BIO_s_mem());  // input
+    if (false == private_bank(theNotary, lDenomination, keys)) {
+        return false;
+    }
 
-    // --- copy theCleartextToken to bioCoin so lucre can load it
-    BIO_puts(bioCoin, theCleartextToken.Get());
+    Banks banks{};
+    auto* bank = get_bank(banks, keys, lDenomination);
 
-    // --- The Mint private info is encrypted in m_mapPrivate[lDenomination].
-    // So I need to extract that first before I can use it.
-    Armored theArmor;
-    GetPrivate(theArmor, lDenomination);
-    OTEnvelope theEnvelope(theArmor);
+    if (nullptr == bank) { return false; }
 
-    auto strContents =
-        String::Factory();  // will contain output from opening the envelope.
-    // Decrypt the Envelope into strContents
-    if (theEnvelope.Open(theNotary, strContents)) {
-        // copy strContents to a BIO
-        BIO_puts(bioBank, strContents->Get());
-
-        // ---- Now the bank and coin bios are both ready to go...
-
-        Bank bank(bioBank);
-        Coin coin(bioCoin);
-
-        if (bank.Verify(coin))  // Here's the boolean output: coin is verified!
-        {
-            bReturnValue = true;
-
-            // (Done): When a token is redeemed, need to store it in the spent
-            // token database.
-            // Right now I can verify the token, but unless I check it against a
-            // database, then
-            // even though the signature verifies, it doesn't stop people from
-            // redeeming the same
-            // token again and again and again.
-            //
-            // (done): also need to make sure issuer has double-entries for
-            // total amount outstanding.
-            //
-            // UPDATE: These are both done now.  The Spent Token database is
-            // implemented in the transaction server,
-            // (not OTLib proper) and the same server also now keeps a cash
-            // account to match all cash withdrawals.
-            // (Meaning, if 10,000 clams total have been withdrawn by various
-            // users, then the server actually has
-            // a clam account containing 10,000 clams. As the cash comes in for
-            // redemption, the server debits it from
-            // this account again before sending it to its final destination.
-            // This way the server tracks total outstanding
-            // amount, as an additional level of security after the blind
-            // signature itself.)
-        }
+    return verify(*bank, theCleartextToken.Get());
+}
+
+bool MintLucre::VerifyTokens(
+    const Nym& theNotary,
+    const std::vector<std::pair<std::string, std::int64_t>>& tokens,
+    std::vector<bool>& verified)
+{
+    LucreDumper setDumper;
+    std::map<std::int64_t, std::string> keys{};
+    // std::vector<bool> can not be written from several threads at once
+    std::vector<char> results(tokens.size(), 0);
+
+    for (const auto& token : tokens) {
+        private_bank(theNotary, token.second, keys);
     }
 
-    return bReturnValue;
-}
+    parallel(tokens.size(), [&](Banks& banks, const std::size_t i) -> void {
+        const auto& [cleartext, denomination] = tokens.at(i);
+        auto* bank = get_bank(banks, keys, denomination);
 
+        if (nullptr == bank) { return; }
+
+        results.at(i) = verify(*bank, cleartext) ? 1 : 0;
+    });
+
+    verified.assign(results.begin(), results.end());
+
+    for (const auto& result : results) {
+        if (0 == result) { return false; }
+    }
+
+    return true;
+}
 #endif  // OT_CRYPTO_USING_OPENSSL
 #endif  // OT_CASH_USING_LUCRE
 }  // namespace opentxs
@@ -2882,6 +2882,10 @@ bool OTClient::processServerReply(
         return false;
     }
 
+    // Balance and transaction statements are only range encoded once the
+    // notary has shown that it can read them
+    if (theReply.AcceptsRanges()) { context.SetAcceptsRanges(); }
+
     // TODO it's not possible to use the message outbuffer to detect duplicate
     // or unsolicited server replies. The processing function for each
     // individual message type must be capable properly detecting this
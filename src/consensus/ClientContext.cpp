@@ -85,7 +85,7 @@ bool ClientContext::CloseCronItem(const TransactionNumber number)
     return (0 < output);
 }
 
-void ClientContext::FinishAcknowledgements(const std::set<RequestNumber>& req)
+void ClientContext::FinishAcknowledgements(const IntervalSet& req)
 {
     Lock lock(lock_);
 
@@ -173,7 +173,7 @@ bool ClientContext::Verify(
 {
     Lock lock(lock_);
 
-    std::set<TransactionNumber> effective = issued_transaction_numbers_;
+    auto effective = issued_transaction_numbers_;
 
     for (const auto& number : included) {
         const bool inserted = effective.insert(number).second;
@@ -205,6 +205,10 @@ bool ClientContext::Verify(
                << "the context. " << std::endl;
     }
 
+    // Comparing ranges avoids walking every number. The loops below only run
+    // to report which number differs.
+    if (effective == statement.Issued()) { return true; }
+
     for (const auto& number : statement.Issued()) {
         const bool found = (1 == effective.count(number));
 
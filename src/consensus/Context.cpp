@@ -85,7 +85,7 @@ std::set<RequestNumber> Context::AcknowledgedNumbers() const
 {
     Lock lock(lock_);
 
-    return acknowledged_request_numbers_;
+    return acknowledged_request_numbers_.Set();
 }
 
 bool Context::add_acknowledged_number(const Lock& lock, const RequestNumber req)
@@ -96,7 +96,7 @@ bool Context::add_acknowledged_number(const Lock& lock, const RequestNumber req)
 
     while (OT_MAX_ACK_NUMS < acknowledged_request_numbers_.size()) {
         acknowledged_request_numbers_.erase(
-            acknowledged_request_numbers_.begin());
+            *acknowledged_request_numbers_.begin());
     }
 
     return output.second;
@@ -152,9 +152,7 @@ proto::Context Context::contract(const Lock& lock) const
 
 // This method will remove entries from acknowledged_request_numbers_ if they
 // are not on the provided set
-void Context::finish_acknowledgements(
-    const Lock& lock,
-    const std::set<RequestNumber>& req)
+void Context::finish_acknowledgements(const Lock& lock, const IntervalSet& req)
 {
     OT_ASSERT(verify_write_lock(lock));
 
@@ -341,7 +339,7 @@ std::set<TransactionNumber> Context::IssuedNumbers() const
 {
     Lock lock(lock_);
 
-    return issued_transaction_numbers_;
+    return issued_transaction_numbers_.Set();
 }
 
 std::string Context::LegacyDataFolder() const { return api_.DataFolder(); }
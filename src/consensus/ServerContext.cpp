@@ -80,6 +80,7 @@ ServerContext::ServerContext(
     , admin_password_("")
     , admin_attempted_(Flag::Factory(false))
     , admin_success_(Flag::Factory(false))
+    , accepts_ranges_(Flag::Factory(false))
     , revision_(0)
     , highest_transaction_number_(0)
     , tentative_transaction_numbers_()
@@ -104,6 +105,7 @@ ServerContext::ServerContext(
     , admin_attempted_(
           Flag::Factory(serialized.servercontext().adminattempted()))
     , admin_success_(Flag::Factory(serialized.servercontext().adminsuccess()))
+    , accepts_ranges_(Flag::Factory(false))
     , revision_(serialized.servercontext().revision())
     , highest_transaction_number_(
           serialized.servercontext().highesttransactionnumber())
@@ -229,8 +231,8 @@ std::unique_ptr<TransactionStatement> ServerContext::generate_statement(
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::set<TransactionNumber> issued;
-    std::set<TransactionNumber> available;
+    IntervalSet issued;
+    IntervalSet available;
 
     for (const auto& number : issued_transaction_numbers_) {
         const bool include = (0 == without.count(number));
@@ -247,7 +249,10 @@ std::unique_ptr<TransactionStatement> ServerContext::generate_statement(
     }
 
     std::unique_ptr<TransactionStatement> output(new TransactionStatement(
-        String::Factory(server_id_)->Get(), issued, available));
+        String::Factory(server_id_)->Get(),
+        issued,
+        available,
+        accepts_ranges_.get()));
 
     return output;
 }
@@ -303,7 +308,7 @@ std::pair<RequestNumber, std::unique_ptr<Message>> ServerContext::
         String::Factory(std::to_string(requestNumber).c_str());
 
     if (withAcknowledgments) {
-        message->SetAcknowledgments(acknowledged_request_numbers_);
+        message->SetAcknowledgments(acknowledged_request_numbers_.Set());
     }
 
     if (withNymboxHash) {
@@ -395,9 +400,8 @@ ServerContext::ManagedNumber ServerContext::NextTransactionNumber(
         return ManagedNumber(0, *this);
     }
 
-    auto first = available_transaction_numbers_.begin();
-    const auto output = *first;
-    available_transaction_numbers_.erase(first);
+    const auto output = *available_transaction_numbers_.begin();
+    available_transaction_numbers_.erase(output);
 
     return ManagedNumber(output, *this);
 }
@@ -488,19 +492,23 @@ bool ServerContext::Resync(const proto::Context& serialized)
         }
     }
 
+    std::set<TransactionNumber> removed{};
+
     for (const auto& number : issued_transaction_numbers_) {
         auto exists = (1 == serverNumbers.count(number));
 
-        if (false == exists) {
-            otErr << OT_METHOD << __FUNCTION__ << ": Server believes number "
-                  << number << " is no longer issued. Removing." << std::endl;
-            issued_transaction_numbers_.erase(number);
-            available_transaction_numbers_.erase(number);
-        }
+        if (false == exists) { removed.insert(number); }
+    }
+
+    for (const auto& number : removed) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Server believes number "
+              << number << " is no longer issued. Removing." << std::endl;
+        issued_transaction_numbers_.erase(number);
+        available_transaction_numbers_.erase(number);
     }
 
     std::set<TransactionNumber> notUsed{};
-    update_highest(lock, issued_transaction_numbers_, notUsed, notUsed);
+    update_highest(lock, issued_transaction_numbers_.Set(), notUsed, notUsed);
 
     return true;
 }
@@ -552,6 +560,8 @@ const Identifier& ServerContext::server_nym_id(const Lock& lock) const
     return remote_nym_->ID();
 }
 
+void ServerContext::SetAcceptsRanges() { accepts_ranges_->On(); }
+
 void ServerContext::SetAdminAttempted()
 {
     Lock lock(lock_);
@@ -12,20 +12,23 @@
 #include "opentxs/core/Contract.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
-#include "opentxs/core/NumList.hpp"
 #include "opentxs/core/OTStringXML.hpp"
 
 #include <irrxml/irrXML.hpp>
 
+#define STATEMENT_VERSION "1.0"
+#define STATEMENT_RANGES_VERSION "2.0"
+
 #define OT_METHOD "opentxs::TransactionStatement::"
 
 namespace opentxs
 {
 TransactionStatement::TransactionStatement(
     const std::string& notary,
-    const std::set<TransactionNumber>& issued,
-    const std::set<TransactionNumber>& available)
-    : version_("1.0")
+    const IntervalSet& issued,
+    const IntervalSet& available,
+    const bool ranges)
+    : version_(ranges ? STATEMENT_RANGES_VERSION : STATEMENT_VERSION)
     , nym_id_("")
     , notary_(notary)
     , available_(available)
@@ -66,20 +69,16 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         break;
                     }
 
-                    NumList numlist;
-
-                    if (!list->empty()) { numlist.Add(list); }
-
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Transaction Number " << number
-                               << " ready-to-use for NotaryID: " << notary_
-                               << std::endl;
-                        available_.insert(number);
+                    if (false == available_.Decode(list->Get())) {
+                        otErr << __FUNCTION__
+                              << ": Error: invalid transactionNums field."
+                              << std::endl;
+                        break;
                     }
+
+                    otLog3 << available_.size()
+                           << " transaction numbers ready-to-use for NotaryID: "
+                           << notary_ << std::endl;
                 } else if (nodeName->Compare("issuedNums")) {
                     notary_ = xml->getAttributeValue("notaryID");
                     auto list = String::Factory();
@@ -93,20 +92,16 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         break;
                     }
 
-                    NumList numlist;
-
-                    if (!list->empty()) { numlist.Add(list); }
-
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Currently liable for issued trans# "
-                               << number << " at NotaryID: " << notary_
-                               << std::endl;
-                        issued_.insert(number);
+                    if (false == issued_.Decode(list->Get())) {
+                        otErr << __FUNCTION__
+                              << ": Error: invalid issuedNums field."
+                              << std::endl;
+                        break;
                     }
+
+                    otLog3 << "Currently liable for " << issued_.size()
+                           << " issued transaction numbers at NotaryID: "
+                           << notary_ << std::endl;
                 } else {
                     otErr << "Unknown element type in " << __FUNCTION__ << ": "
                           << nodeName << std::endl;
@@ -127,23 +122,22 @@ TransactionStatement::operator String() const
     auto output = String::Factory();
 
     Tag serialized("nymData");
+    const bool ranges = (STATEMENT_RANGES_VERSION == version_);
 
     serialized.add_attribute("version", version_);
     serialized.add_attribute("nymID", nym_id_);
 
     if (0 < issued_.size()) {
-        NumList issuedList(issued_);
-        auto issued = String::Factory();
-        issuedList.Output(issued);
+        auto issued = String::Factory(
+            ranges ? issued_.EncodeRanges() : issued_.Encode());
         TagPtr issuedTag(new Tag("issuedNums", Armored(issued).Get()));
         issuedTag->add_attribute("notaryID", notary_);
         serialized.add_tag(issuedTag);
     }
 
     if (0 < available_.size()) {
-        NumList availableList(available_);
-        auto available = String::Factory();
-        availableList.Output(available);
+        auto available = String::Factory(
+            ranges ? available_.EncodeRanges() : available_.Encode());
         TagPtr availableTag(
             new Tag("transactionNums", Armored(available).Get()));
         availableTag->add_attribute("notaryID", notary_);
@@ -156,7 +150,7 @@ TransactionStatement::operator String() const
     return result.c_str();
 }
 
-const std::set<TransactionNumber>& TransactionStatement::Issued() const
+const IntervalSet& TransactionStatement::Issued() const
 {
     return issued_;
 }
@@ -23,6 +23,8 @@
 
 #include "Data.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <set>
 #include <map>
 
@@ -40,6 +42,12 @@ bool less<opentxs::Pimpl<opentxs::Identifier>>::operator()(
 {
     return lhs.get() < rhs.get();
 }
+
+std::size_t hash<opentxs::Pimpl<opentxs::Identifier>>::operator()(
+    const opentxs::OTIdentifier& id) const
+{
+    return id->Hash();
+}
 }  // namespace std
 
 namespace opentxs
@@ -207,38 +215,32 @@ Identifier::Identifier(
 
 bool Identifier::operator==(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.Compare(ots2);
+    return 0 == compare(s2);
 }
 
 bool Identifier::operator!=(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return !(ots1.Compare(ots2));
+    return 0 != compare(s2);
 }
 
 bool Identifier::operator>(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>(ots2);
+    return 0 < compare(s2);
 }
 
 bool Identifier::operator<(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<(ots2);
+    return 0 > compare(s2);
 }
 
 bool Identifier::operator<=(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<=(ots2);
+    return 0 >= compare(s2);
 }
 
 bool Identifier::operator>=(const opentxs::Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>=(ots2);
+    return 0 <= compare(s2);
 }
 
 bool Identifier::CalculateDigest(const String& strInput, const ID type)
@@ -257,6 +259,46 @@ bool Identifier::CalculateDigest(const opentxs::Data& dataInput, const ID type)
         IDToHashType(type_), dataInput, *this);
 }
 
+// Orders identifiers by type, then by their binary value. Empty identifiers
+// are equal regardless of type and sort before everything else, matching the
+// behavior of comparing the encoded forms.
+int Identifier::compare(const opentxs::Identifier& rhs) const
+{
+    const auto lhsSize = size();
+    const auto rhsSize = rhs.size();
+
+    if ((0 == lhsSize) || (0 == rhsSize)) {
+        return static_cast<int>(0 < lhsSize) - static_cast<int>(0 < rhsSize);
+    }
+
+    const auto rhsType = rhs.Type();
+
+    if (type_ != rhsType) { return (type_ < rhsType) ? -1 : 1; }
+
+    const auto common = std::min(lhsSize, rhsSize);
+    const auto result = std::memcmp(data(), rhs.data(), common);
+
+    if (0 != result) { return result; }
+
+    if (lhsSize == rhsSize) { return 0; }
+
+    return (lhsSize < rhsSize) ? -1 : 1;
+}
+
+std::size_t Identifier::Hash() const
+{
+    const auto bytes = size();
+
+    if (0 == bytes) { return 0; }
+
+    // Identifiers are digests, so their leading bytes are already uniformly
+    // distributed
+    std::size_t output{0};
+    std::memcpy(&output, data(), std::min(bytes, sizeof(output)));
+
+    return output ^ static_cast<std::size_t>(type_);
+}
+
 Identifier* Identifier::clone() const
 {
     return new Identifier(data_, position_, type_);
@@ -267,18 +309,9 @@ Identifier* Identifier::clone() const
 // Just call this function.
 void Identifier::GetString(String& id) const
 {
-    auto data = Data::Factory();
-    data->Assign(&type_, sizeof(type_));
-
-    OT_ASSERT(1 == data->size());
-
     if (0 == size()) { return; }
 
-    data->Concatenate(this->data(), size());
-
-    String output("ot");
-    output.Concatenate(
-        String(OT::App().Crypto().Encode().IdentifierEncode(data).c_str()));
+    String output(str());
     id.swap(output);
 }
 
@@ -354,13 +387,11 @@ void Identifier::SetString(const std::string& encoded)
 
 std::string Identifier::str() const
 {
-    auto data = Data::Factory();
-    data->Assign(&type_, sizeof(type_));
-
-    OT_ASSERT(1 == data->size());
-
     if (0 == size()) { return {}; }
 
+    static_assert(1 == sizeof(type_));
+
+    auto data = Data::Factory(&type_, sizeof(type_));
     data->Concatenate(this->data(), size());
 
     std::string output("ot");
@@ -24,6 +24,7 @@ public:
     bool operator>=(const opentxs::Identifier& rhs) const override;
 
     void GetString(String& theStr) const override;
+    std::size_t Hash() const override;
     std::string str() const override;
     const ID& Type() const override { return type_; }
 
@@ -48,6 +49,7 @@ private:
     ID type_{DefaultType};
 
     Identifier* clone() const override;
+    int compare(const opentxs::Identifier& rhs) const;
 
     static proto::HashType IDToHashType(const ID type);
     static OTData path_to_data(
@@ -0,0 +1,347 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/IntervalSet.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+
+// Upper limit on the number of values produced by decoding a single list. The
+// encoded form arrives from peers, and a range lets a few bytes describe
+// billions of values.
+#ifndef OT_MAX_DECODED_NUMS
+#define OT_MAX_DECODED_NUMS 100000
+#endif
+
+namespace opentxs
+{
+IntervalSet::const_iterator::const_iterator(
+    const Ranges& ranges,
+    const Ranges::const_iterator range,
+    const value_type value)
+    : ranges_(&ranges)
+    , range_(range)
+    , value_(value)
+{
+}
+
+IntervalSet::const_iterator& IntervalSet::const_iterator::operator++()
+{
+    if (value_ < range_->second) {
+        ++value_;
+
+        return *this;
+    }
+
+    ++range_;
+    value_ = (ranges_->end() == range_) ? 0 : range_->first;
+
+    return *this;
+}
+
+IntervalSet::const_iterator IntervalSet::const_iterator::operator++(int)
+{
+    auto output = *this;
+    ++(*this);
+
+    return output;
+}
+
+bool IntervalSet::const_iterator::operator==(const const_iterator& rhs) const
+{
+    return (range_ == rhs.range_) && (value_ == rhs.value_);
+}
+
+bool IntervalSet::const_iterator::operator!=(const const_iterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+IntervalSet::IntervalSet()
+    : ranges_()
+    , size_(0)
+{
+}
+
+IntervalSet::IntervalSet(const std::set<value_type>& values)
+    : IntervalSet()
+{
+    auto it = values.begin();
+
+    while (values.end() != it) {
+        const auto first = *it;
+        auto last = first;
+
+        while ((values.end() != ++it) && (*it == last + 1)) { last = *it; }
+
+        ranges_.emplace_hint(ranges_.end(), first, last);
+    }
+
+    size_ = values.size();
+}
+
+IntervalSet::const_iterator IntervalSet::begin() const
+{
+    if (ranges_.empty()) { return end(); }
+
+    const auto first = ranges_.begin();
+
+    return const_iterator(ranges_, first, first->first);
+}
+
+void IntervalSet::clear()
+{
+    ranges_.clear();
+    size_ = 0;
+}
+
+std::size_t IntervalSet::count(const value_type value) const
+{
+    auto it = ranges_.upper_bound(value);
+
+    if (ranges_.begin() == it) { return 0; }
+
+    --it;
+
+    return (value <= it->second) ? 1 : 0;
+}
+
+bool IntervalSet::Decode(const std::string& encoded)
+{
+    clear();
+    const auto* const start = encoded.c_str();
+    const auto* position = start;
+    const auto* const stop = start + encoded.size();
+    auto separator = [](const char c) -> bool {
+        return (',' == c) || std::isspace(static_cast<unsigned char>(c));
+    };
+    auto number = [&position](value_type& output) -> bool {
+        const auto c = static_cast<unsigned char>(*position);
+
+        if ((0 == std::isdigit(c)) && ('-' != c)) { return false; }
+
+        char* next{nullptr};
+        errno = 0;
+        output = std::strtoll(position, &next, 10);
+
+        if ((next == position) || (ERANGE == errno)) { return false; }
+
+        position = next;
+
+        return true;
+    };
+
+    while ((position < stop) && separator(*position)) { ++position; }
+
+    while (position < stop) {
+        value_type first{0};
+
+        if (false == number(first)) { return false; }
+
+        auto last = first;
+
+        if ((position < stop) && ('-' == *position)) {
+            ++position;
+
+            if ((position >= stop) || (false == number(last))) {
+                return false;
+            }
+        }
+
+        if ((first > last) || ((position < stop) && !separator(*position))) {
+            return false;
+        }
+
+        // Compared before adding one so that the widest possible range can
+        // not wrap around to zero
+        const auto span = static_cast<std::uint64_t>(last) -
+                          static_cast<std::uint64_t>(first);
+
+        if (span >= (OT_MAX_DECODED_NUMS - size_)) { return false; }
+
+        InsertRange(first, last);
+
+        while ((position < stop) && separator(*position)) { ++position; }
+    }
+
+    return true;
+}
+
+std::string IntervalSet::Encode() const
+{
+    std::string output{};
+
+    for (const auto& value : *this) {
+        if (false == output.empty()) { output += ','; }
+
+        output += std::to_string(value);
+    }
+
+    return output;
+}
+
+std::string IntervalSet::EncodeRanges() const
+{
+    std::string output{};
+
+    for (const auto& [first, last] : ranges_) {
+        if (false == output.empty()) { output += ','; }
+
+        output += std::to_string(first);
+
+        if (first != last) { output += '-' + std::to_string(last); }
+    }
+
+    return output;
+}
+
+IntervalSet::const_iterator IntervalSet::end() const
+{
+    return const_iterator(ranges_, ranges_.end(), 0);
+}
+
+std::size_t IntervalSet::erase(const value_type value)
+{
+    auto it = ranges_.upper_bound(value);
+
+    if (ranges_.begin() == it) { return 0; }
+
+    --it;
+    const auto first = it->first;
+    const auto last = it->second;
+
+    if (value > last) { return 0; }
+
+    if (value == first) {
+        it = ranges_.erase(it);
+
+        if (value != last) { ranges_.emplace_hint(it, value + 1, last); }
+    } else {
+        it->second = value - 1;
+
+        if (value != last) { ranges_.emplace_hint(++it, value + 1, last); }
+    }
+
+    --size_;
+
+    return 1;
+}
+
+std::pair<IntervalSet::const_iterator, bool> IntervalSet::insert(
+    const value_type value)
+{
+    auto next = ranges_.upper_bound(value);
+    // A following range can only exist if value is not the maximum, so
+    // value + 1 can not overflow when it is evaluated
+    const bool joinNext =
+        (ranges_.end() != next) && (next->first == value + 1);
+
+    if (ranges_.begin() != next) {
+        auto previous = std::prev(next);
+
+        if (value <= previous->second) {
+
+            return {const_iterator(ranges_, previous, value), false};
+        }
+
+        if (value == previous->second + 1) {
+            if (joinNext) {
+                previous->second = next->second;
+                ranges_.erase(next);
+            } else {
+                previous->second = value;
+            }
+
+            ++size_;
+
+            return {const_iterator(ranges_, previous, value), true};
+        }
+    }
+
+    auto last = value;
+
+    if (joinNext) {
+        last = next->second;
+        next = ranges_.erase(next);
+    }
+
+    auto it = ranges_.emplace_hint(next, value, last);
+    ++size_;
+
+    return {const_iterator(ranges_, it, value), true};
+}
+
+std::size_t IntervalSet::InsertRange(
+    const value_type first,
+    const value_type last)
+{
+    if (first > last) { return 0; }
+
+    auto start = first;
+    auto stop = last;
+    std::size_t existing{0};
+    auto it = ranges_.upper_bound(first);
+
+    if (ranges_.begin() != it) {
+        const auto previous = std::prev(it);
+
+        if ((previous->second >= first) || (previous->second + 1 == first)) {
+            it = previous;
+        }
+    }
+
+    // Absorb every range which overlaps or touches the new one
+    while ((ranges_.end() != it) &&
+           ((it->first <= last) || (it->first - 1 == last))) {
+        const auto low = std::max(it->first, first);
+        const auto high = std::min(it->second, last);
+
+        if (low <= high) { existing += width(low, high); }
+
+        start = std::min(start, it->first);
+        stop = std::max(stop, it->second);
+        it = ranges_.erase(it);
+    }
+
+    ranges_.emplace_hint(it, start, stop);
+    const auto added = width(first, last) - existing;
+    size_ += added;
+
+    return added;
+}
+
+std::set<IntervalSet::value_type> IntervalSet::Set() const
+{
+    std::set<value_type> output{};
+
+    for (const auto& value : *this) {
+        output.emplace_hint(output.end(), value);
+    }
+
+    return output;
+}
+
+std::size_t IntervalSet::width(const value_type first, const value_type last)
+{
+    return static_cast<std::size_t>(
+               static_cast<std::uint64_t>(last) -
+               static_cast<std::uint64_t>(first)) +
+           1;
+}
+
+bool IntervalSet::operator==(const IntervalSet& rhs) const
+{
+    return ranges_ == rhs.ranges_;
+}
+
+bool IntervalSet::operator!=(const IntervalSet& rhs) const
+{
+    return !(*this == rhs);
+}
+}  // namespace opentxs
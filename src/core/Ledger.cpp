@@ -127,25 +127,46 @@ char const* Ledger::_GetTypeString(ledgerType theType)
 // it.
 //
 bool Ledger::VerifyAccount(const Nym& theNym)
+{
+    if (false == verify_type(theNym)) { return false; }
+
+    // message ledgers do not load Box Receipts. (They store full version
+    // internally already.)
+    if (ledgerType::message != GetType()) {
+        std::set<std::int64_t> setUnloaded;
+        // if psetUnloaded passed in, then use it to return the #s that
+        // weren't there as box receipts.
+        //          bool bLoadedBoxReceipts =
+        LoadBoxReceipts(&setUnloaded);  // Note: Also useful for suppressing
+                                        // errors here.
+    }
+
+    return OTTransactionType::VerifyAccount(theNym);
+}
+
+// Verifies the box itself without loading any box receipts. (The abbreviated
+// records are verified against each box receipt when it's loaded.)
+//
+bool Ledger::VerifyAbbreviated(const Nym& theNym)
+{
+    if (false == verify_type(theNym)) { return false; }
+
+    return OTTransactionType::VerifyAccount(theNym);
+}
+
+bool Ledger::verify_type(const Nym& theNym) const
 {
     switch (GetType()) {
-        case ledgerType::message:  // message ledgers do not load Box Receipts.
-                                   // (They
-                                   // store full version internally already.)
-            break;
+        case ledgerType::message:
         case ledgerType::nymbox:
         case ledgerType::inbox:
         case ledgerType::outbox:
         case ledgerType::paymentInbox:
         case ledgerType::recordBox:
         case ledgerType::expiredBox: {
-            std::set<std::int64_t> setUnloaded;
-            // if psetUnloaded passed in, then use it to return the #s that
-            // weren't there as box receipts.
-            //          bool bLoadedBoxReceipts =
-            LoadBoxReceipts(&setUnloaded);  // Note: Also useful for suppressing
-                                            // errors here.
-        } break;
+
+            return true;
+        }
         default: {
             const std::int32_t nLedgerType =
                 static_cast<std::int32_t>(GetType());
@@ -157,10 +178,9 @@ bool Ledger::VerifyAccount(const Nym& theNym)
                   << nLedgerType << ", NymID: " << strNymID
                   << ", AcctID: " << strAccountID << "\n";
         }
-            return false;
     }
 
-    return OTTransactionType::VerifyAccount(theNym);
+    return false;
 }
 
 // This makes sure that ALL transactions inside the ledger are saved as box
@@ -251,20 +271,29 @@ bool Ledger::LoadBoxReceipts(std::set<std::int64_t>* psetUnloaded)
         the_set.insert(pTransaction->GetTransactionNum());
     }
 
+    return LoadBoxReceipts(the_set, psetUnloaded);
+}
+
+// Same as above, but only for the transaction #s in numbers. This allows the
+// caller to load one page of a large box at a time.
+bool Ledger::LoadBoxReceipts(
+    const std::set<std::int64_t>& numbers,
+    std::set<std::int64_t>* psetUnloaded)
+{
     // Now iterate through those numbers and for each, load the box receipt.
     //
     bool bRetVal = true;
 
-    for (auto& it : the_set) {
+    for (auto& it : numbers) {
         std::int64_t lSetNum = it;
 
         const auto pTransaction = GetTransaction(lSetNum);
-        OT_ASSERT(false != bool(pTransaction));
 
         // Failed loading the boxReceipt
         //
-        if ((true == pTransaction->IsAbbreviated()) &&
-            (false == LoadBoxReceipt(lSetNum))) {
+        if ((false == bool(pTransaction)) ||
+            ((true == pTransaction->IsAbbreviated()) &&
+             (false == LoadBoxReceipt(lSetNum)))) {
             // WARNING: pTransaction must be re-Get'd below this point if
             // needed, since pointer
             // is bad if success on LoadBoxReceipt() call.
@@ -36,10 +36,12 @@
 #include <exception>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <typeinfo>
+#include <utility>
 
 extern "C" {
 
@@ -123,33 +125,37 @@ LogSource LogInsane{5};
 OTLogStream::OTLogStream(int _logLevel)
     : std::ostream(this)
     , logLevel(_logLevel)
-    , next(0)
-    , pBuffer(new char[1024])
 {
+    if (0 < logLevel) { setstate(std::ios::badbit); }
 }
 
-OTLogStream::~OTLogStream()
+void OTLogStream::SetVerbosity(const std::int32_t level)
 {
-    delete[] pBuffer;
-    pBuffer = nullptr;
+    for (auto* stream : {&otOut, &otWarn, &otInfo, &otLog3}) {
+        if ((-1 == level) || (stream->logLevel > level)) {
+            stream->setstate(std::ios::badbit);
+        } else {
+            stream->clear();
+        }
+    }
 }
 
 int OTLogStream::overflow(int c)
 {
-    rLock lock(lock_);
+    // Each thread assembles its own lines, so no lock is needed here
+    thread_local std::map<const OTLogStream*, std::string> buffers{};
 
-    pBuffer[next++] = c;
-    if (c != '\n' && next < 1000) { return 0; }
+    if (traits_type::eq_int_type(c, traits_type::eof())) { return 0; }
 
-    pBuffer[next++] = '\0';
-    next = 0;
+    auto& buffer = buffers[this];
+    buffer.push_back(traits_type::to_char_type(c));
 
-    if (logLevel < 0) {
-        Log::Error(pBuffer);
-        return 0;
-    }
+    if (('\n' != c) && (buffer.size() < 1000)) { return 0; }
+
+    std::string line{};
+    line.swap(buffer);
+    LogSource::dispatch(logLevel, std::move(line));
 
-    Log::Output(logLevel, pBuffer);
     return 0;
 }
 
@@ -157,7 +163,7 @@ Log::Log(const api::Settings& config)
     : config_(config)
     , m_strLogFileName(String::Factory())
     , m_strLogFilePath(String::Factory())
-
+    , log_file_()
 {
     bool notUsed{false};
     config_.Check_bool(
@@ -182,6 +188,7 @@ bool Log::Init(
     if (!pLogger->m_bInitialized) {
         pLogger->m_nLogLevel = nLogLevel;
         LogSource::SetVerbosity(nLogLevel);
+        OTLogStream::SetVerbosity(nLogLevel);
 
         if (!strThreadContext->Exists() ||
             strThreadContext->Compare(""))  // global
@@ -298,6 +305,7 @@ bool Log::SetLogLevel(const std::int32_t& nLogLevel)
     } else {
         pLogger->m_nLogLevel = nLogLevel;
         LogSource::SetVerbosity(nLogLevel);
+        OTLogStream::SetVerbosity(nLogLevel);
 
         return true;
     }
@@ -312,44 +320,47 @@ bool Log::SetLogLevel(const std::int32_t& nLogLevel)
 //
 // static
 bool Log::LogToFile(const String& strOutput)
+{
+    return write(strOutput.Get(), true);
+}
+
+// static private
+bool Log::write(const std::string& text, const bool flush)
 {
     // We now do this either way.
-    {
-        std::cerr << strOutput;
-        std::cerr.flush();
-    }
+    std::cerr << text;
+
+    if (flush) { std::cerr.flush(); }
 
     // now log to file, if we can.
+    if (false == IsInitialized()) { return false; }
 
-    bool bHaveLogger(false);
-    if (nullptr != pLogger)
-        if (pLogger->IsInitialized()) bHaveLogger = true;
+    if (false == pLogger->write_log_file_) { return true; }
 
-    // lets check if we are Initialized in this context
-    if (bHaveLogger) CheckLogger(Log::pLogger);
+    if (text.empty()) { return false; }
 
-    if (nullptr != pLogger) { rLock lock(Log::pLogger->lock_); }
+    rLock lock(pLogger->lock_);
+    auto& file = pLogger->log_file_;
 
-    bool bSuccess = false;
+    // The file is opened once and kept open, instead of once per line
+    if (false == file.is_open()) {
+        if (false == pLogger->m_strLogFilePath->Exists()) { return false; }
 
-    if (bHaveLogger) {
-        if (false == pLogger->write_log_file_) { return true; }
+        file.open(LogFilePath(), std::ios::app);
 
-        // Append to logfile
-        if ((strOutput.Exists()) &&
-            (Log::pLogger->m_strLogFilePath->Exists())) {
-            std::ofstream logfile;
-            logfile.open(Log::LogFilePath(), std::ios::app);
+        if (file.fail()) {
+            file.close();
+            file.clear();
 
-            if (!logfile.fail()) {
-                logfile << strOutput;
-                logfile.close();
-                bSuccess = true;
-            }
+            return false;
         }
     }
 
-    return bSuccess;
+    file << text;
+
+    if (flush) { file.flush(); }
+
+    return (false == file.fail());
 }
 
 // static
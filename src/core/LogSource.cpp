@@ -7,24 +7,41 @@
 
 #include "opentxs/core/LogSource.hpp"
 
-#include "opentxs/api/Native.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PushSocket.hpp"
-#include "opentxs/OT.hpp"
+
+#include <chrono>
+#include <utility>
 
 #define LOG_SINK "inproc://opentxs/logsink/1"
+// Maximum number of lines waiting for the sink. Further lines are dropped
+// and counted rather than blocking the thread which is logging.
+#define LOG_QUEUE_LIMIT 1000
 
 namespace zmq = opentxs::network::zeromq;
 
+namespace
+{
+// Set while this thread is creating its push socket, so that anything logged
+// during socket setup is written directly instead of re-entering get_buffer
+thread_local bool creating_socket_{false};
+}  // namespace
+
 namespace opentxs
 {
 std::atomic<int> LogSource::verbosity_{0};
-std::atomic<bool> LogSource::running_{true};
+std::atomic<bool> LogSource::running_{false};
+std::atomic<std::uint64_t> LogSource::generation_{0};
+std::atomic<std::size_t> LogSource::queued_{0};
+std::atomic<std::uint64_t> LogSource::dropped_{0};
 std::mutex LogSource::buffer_lock_{};
 std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
+const network::zeromq::Context* LogSource::context_{nullptr};
 
 LogSource::LogSource(const int logLevel)
     : level_(logLevel)
@@ -67,43 +84,115 @@ const LogSource& LogSource::operator()(const Identifier& in) const
     return operator()(in.str().c_str());
 }
 
+bool LogSource::consumed() { return 1 == queued_.fetch_sub(1); }
+
+void LogSource::dispatch(const int level, std::string&& text)
+{
+    if (running_.load() && (false == creating_socket_)) {
+        if ((0 <= level) && (verbosity_.load() < level)) { return; }
+
+        if ((false == text.empty()) && ('\n' == text.back())) {
+            text.pop_back();
+        }
+
+        std::string id{};
+        auto& socket = std::get<0>(get_buffer(id));
+        send(socket, level, std::move(text), id);
+
+        return;
+    }
+
+    if (0 > level) {
+        Log::Error(text.c_str());
+    } else {
+        Log::Output(level, text.c_str());
+    }
+}
+
+std::uint64_t LogSource::dropped() { return dropped_.exchange(0); }
+
 void LogSource::Flush() const
 {
+    if (verbosity_.load() < level_) { return; }
+
     if (running_.load()) {
         std::string id{};
         auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message::Factory();
-        message->AddFrame();
-        message->AddFrame(std::to_string(level_));
-        message->AddFrame(buffer.str());
-        message->AddFrame(id);
-        socket->Push(message);
+        send(socket, level_, buffer.str(), id);
         buffer = std::stringstream{};
     }
 }
 
 LogSource::Source& LogSource::get_buffer(std::string& out)
 {
+    thread_local std::string threadID{};
+    thread_local Source* cached{nullptr};
+    thread_local std::uint64_t cachedGeneration{0};
+
+    if (threadID.empty()) {
+        std::stringstream convert{};
+        convert << std::this_thread::get_id();
+        threadID = convert.str();
+    }
+
+    out = threadID;
+    const auto generation = generation_.load();
+
+    if ((nullptr != cached) && (generation == cachedGeneration)) {
+        return *cached;
+    }
+
+    Lock lock(buffer_lock_);
     const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << id;
-    out = convert.str();
     auto it = buffer_.find(id);
 
     if (buffer_.end() == it) {
-        Lock lock(buffer_lock_);
-        auto it = buffer_.emplace(
+        OT_ASSERT(nullptr != context_);
+
+        creating_socket_ = true;
+        it = std::get<0>(buffer_.emplace(
             id,
-            Source{OT::App().ZMQ().PushSocket(zmq::Socket::Direction::Connect),
-                   std::stringstream{}});
-        auto& source = std::get<0>(it)->second;
-        auto& socket = std::get<0>(source).get();
+            Source{context_->PushSocket(zmq::Socket::Direction::Connect),
+                   std::stringstream{}}));
+        auto& socket = std::get<0>(it->second).get();
+        socket.SetTimeouts(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(-1));
         socket.Start(LOG_SINK);
+        creating_socket_ = false;
+    }
+
+    cached = &it->second;
+    cachedGeneration = generation;
 
-        return source;
+    return *cached;
+}
+
+void LogSource::send(
+    const OTZMQPushSocket& socket,
+    const int level,
+    std::string&& text,
+    const std::string& id)
+{
+    if (LOG_QUEUE_LIMIT <= queued_.load()) {
+        ++dropped_;
+
+        return;
     }
 
-    return it->second;
+    ++queued_;
+    auto message = zmq::Message::Factory();
+    message->AddFrame();
+    message->AddFrame(Data::Factory(&level, sizeof(level)));
+    message->AddFrame(std::move(text));
+    message->AddFrame(id);
+
+    // A message which never reached the sink will never be consumed
+    if (false == socket->Push(message)) {
+        --queued_;
+        ++dropped_;
+    }
 }
 
 void LogSource::SetVerbosity(const int level) { verbosity_.store(level); }
@@ -111,7 +200,18 @@ void LogSource::SetVerbosity(const int level) { verbosity_.store(level); }
 void LogSource::Shutdown()
 {
     running_.store(false);
+    Lock lock(buffer_lock_);
+    ++generation_;
     buffer_.clear();
+    context_ = nullptr;
+}
+
+void LogSource::Start(const network::zeromq::Context& context)
+{
+    Lock lock(buffer_lock_);
+    context_ = &context;
+    ++generation_;
+    running_.store(true);
 }
 
 const LogSource& LogSource::StartLog(
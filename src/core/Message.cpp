@@ -100,6 +100,11 @@
 #define ADD_CLAIM "addClaim"
 #define ADD_CLAIM_RESPONSE "addClaimResponse"
 
+// Notaries which accept range encoded transaction statements send replies with
+// this version or later. Older peers ignore the version attribute.
+#define MESSAGE_RANGES_VERSION "3.0"
+#define MESSAGE_RANGES_MAJOR_VERSION 3
+
 // PROTOCOL DOCUMENT
 
 // --- This is the file that implements the entire message protocol.
@@ -300,6 +305,11 @@ std::string Message::ReplyCommand(const MessageType type)
     return Command(reply_command(type));
 }
 
+bool Message::AcceptsRanges() const
+{
+    return MESSAGE_RANGES_MAJOR_VERSION <= m_strVersion->ToLong();
+}
+
 bool Message::HarvestTransactionNumbers(
     ServerContext& context,
     bool bHarvestingForRetry,           // false until positively asserted.
@@ -404,6 +414,8 @@ bool Message::HarvestTransactionNumbers(
     return true;
 }
 
+void Message::SetAcceptsRanges() { m_strVersion->Set(MESSAGE_RANGES_VERSION); }
+
 // So the message can get the list of numbers from the Nym, before sending,
 // that should be listed as acknowledged that the server reply has already been
 // seen for those request numbers.
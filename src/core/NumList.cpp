@@ -11,13 +11,11 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
 
-#include <cinttypes>
+#include <cstddef>
 #include <cstdint>
-#include <locale>
 #include <ostream>
 #include <set>
 #include <string>
-#include <utility>
 
 // OTNumList (helper class.)
 
@@ -27,7 +25,7 @@ namespace opentxs
 NumList::NumList(const std::set<std::int64_t>& theNumbers) { Add(theNumbers); }
 
 NumList::NumList(std::set<std::int64_t>&& theNumbers)
-    : m_setData(std::move(theNumbers))
+    : m_setData(theNumbers)
 {
 }
 
@@ -63,8 +61,8 @@ bool NumList::Add(const std::string& strNumbers)  // if false, means the
 }
 
 // This function is private, so you can't use it without passing an OTString.
-// (For security reasons.) It takes a comma-separated list of numbers, and adds
-// them to *this.
+// (For security reasons.) It takes a comma-separated list of numbers and
+// ranges, and adds them to *this.
 //
 bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
                                           // already there. (At least one of
@@ -72,68 +70,21 @@ bool NumList::Add(const char* szNumbers)  // if false, means the numbers were
 {
     OT_ASSERT(nullptr != szNumbers);  // Should never happen.
 
-    bool bSuccess = true;
-    std::int64_t lNum = 0;
-    const char* pChar = szNumbers;
-    std::locale loc;
-
-    // Skip any whitespace.
-    while (std::isspace(*pChar, loc)) pChar++;
-
-    bool bStartedANumber =
-        false;  // During the loop, set this to true when processing a digit,
-                // and set to false when anything else. That way when we go to
-                // add the number to the list, and it's "0", we'll know it's a
-                // real number we're supposed to add, and not just a default
-                // value.
-
-    for (;;)  // We already know it's not null, due to the assert. (So at least
-              // one iteration will happen.)
-    {
-        if (std::isdigit(*pChar, loc)) {
-            bStartedANumber = true;
-
-            std::int32_t nDigit = (*pChar - '0');
-
-            lNum *= 10;  // Move it up a decimal place.
-            lNum += nDigit;
-        }
-        // if separator, or end of string, either way, add lNum to *this.
-        else if (
-            (',' == *pChar) || ('\0' == *pChar) ||
-            std::isspace(*pChar, loc))  // first sign of a space, and we are
-                                        // done with current number. (On to
-                                        // the next.)
-        {
-            if ((lNum > 0) || (bStartedANumber && (0 == lNum))) {
-                if (!Add(lNum))  // <=========
-                {
-                    bSuccess = false;  // We still go ahead and try to add them
-                                       // all, and then return this sort of
-                                       // status when it's all done.
-                }
-            }
-
-            lNum = 0;  // reset for the next transaction number (in the
-                       // comma-separated list.)
-            bStartedANumber = false;  // reset
-        } else {
-            otErr << "OTNumList::Add: Error: Unexpected character found in "
-                     "erstwhile comma-separated list of longs: "
-                  << *pChar << "\n";
-            bSuccess = false;
-            break;
-        }
-
-        // End of the road.
-        if ('\0' == *pChar) break;
+    IntervalSet numbers;
+    // Anything which was parsed before an error is still added
+    bool bSuccess = numbers.Decode(szNumbers);
 
-        pChar++;
+    if (false == bSuccess) {
+        otErr << "OTNumList::Add: Error: Invalid or oversized "
+                 "comma-separated list of longs: "
+              << szNumbers << "\n";
+    }
 
-        // Skip any whitespace.
-        while (std::isspace(*pChar, loc)) pChar++;
+    for (const auto& [first, last] : numbers.GetRanges()) {
+        const auto width = static_cast<std::size_t>(last - first) + 1;
 
-    }  // while
+        if (width != m_setData.InsertRange(first, last)) { bSuccess = false; }
+    }
 
     return bSuccess;
 }
@@ -142,14 +93,7 @@ bool NumList::Add(const std::int64_t& theValue)  // if false, means the value
                                                  // was
                                                  // already there.
 {
-    auto it = m_setData.find(theValue);
-
-    if (m_setData.end() == it)  // it's not already there, so add it.
-    {
-        m_setData.insert(theValue);
-        return true;
-    }
-    return false;  // it was already there.
+    return m_setData.insert(theValue).second;
 }
 
 bool NumList::Peek(std::int64_t& lPeek) const
@@ -170,7 +114,7 @@ bool NumList::Pop()
 
     if (m_setData.end() != it)  // it's there.
     {
-        m_setData.erase(it);
+        m_setData.erase(*it);
         return true;
     }
     return false;
@@ -180,23 +124,15 @@ bool NumList::Remove(const std::int64_t& theValue)  // if false, means the value
                                                     // was
                                                     // NOT already there.
 {
-    auto it = m_setData.find(theValue);
-
-    if (m_setData.end() != it)  // it's there.
-    {
-        m_setData.erase(it);
-        return true;
-    }
-    return false;  // it wasn't there (so how could you remove it then?)
+    // it wasn't there (so how could you remove it then?)
+    return 1 == m_setData.erase(theValue);
 }
 
 bool NumList::Verify(const std::int64_t& theValue) const  // returns true/false
                                                           // (whether value is
                                                           // already there.)
 {
-    auto it = m_setData.find(theValue);
-
-    return (m_setData.end() == it) ? false : true;
+    return 1 == m_setData.count(theValue);
 }
 
 // True/False, based on whether values are already there.
@@ -220,24 +156,20 @@ bool NumList::Verify(const std::set<std::int64_t>& theNumbers) const
 ///
 bool NumList::Verify(const NumList& rhs) const
 {
-    // Verify they have the same number of elements.
-    //
-    if (Count() != rhs.Count()) return false;
-
-    // Verify each value on *this is also found on rhs.
-    //
-    for (auto& it : m_setData) {
-        if (!rhs.Verify(it)) return false;
-    }
-
-    return true;
+    // Both lists are stored as ranges which are merged whenever they touch, so
+    // the same numbers always produce the same ranges.
+    return m_setData == rhs.m_setData;
 }
 
 /// True/False, based on whether ANY of the numbers in rhs are found in *this.
 ///
 bool NumList::VerifyAny(const NumList& rhs) const
 {
-    return rhs.VerifyAny(m_setData);
+    for (const auto& it : rhs.m_setData) {
+        if (Verify(it)) return true;
+    }
+
+    return false;
 }
 
 /// Verify whether ANY of the numbers on *this are found in setData.
@@ -258,10 +190,15 @@ bool NumList::Add(const NumList& theNumList)  // if false, means the numbers
                                               // were already there. (At
                                               // least one of them.)
 {
-    std::set<std::int64_t> theOutput;
-    theNumList.Output(theOutput);  // returns false if the numlist was empty.
+    bool bSuccess = true;
+
+    for (const auto& [first, last] : theNumList.m_setData.GetRanges()) {
+        const auto width = static_cast<std::size_t>(last - first) + 1;
 
-    return Add(theOutput);
+        if (width != m_setData.InsertRange(first, last)) { bSuccess = false; }
+    }
+
+    return bSuccess;
 }
 
 bool NumList::Add(const std::set<std::int64_t>& theNumbers)  // if false, means
@@ -305,33 +242,26 @@ bool NumList::Output(std::set<std::int64_t>& theOutput) const  // returns false
 // the numlist was
 // empty.
 {
-    theOutput = m_setData;
+    theOutput = m_setData.Set();
 
     return !m_setData.empty();
 }
 
-// Outputs the numlist as a comma-separated string (for serialization, usually.)
+// Outputs the numlist as a comma-separated string of numbers (for
+// serialization, usually.)
 //
 bool NumList::Output(String& strOutput) const  // returns false if the
                                                // numlist was empty.
 {
-    std::int32_t nIterationCount = 0;
-
-    for (auto& it : m_setData) {
-        nIterationCount++;
-
-        strOutput.Concatenate(
-            "%s%" PRId64,
-            // If first iteration, prepend a blank string (instead of a comma.)
-            // Like this:  "%" PRId64 ""
-            // But for all subsequent iterations, concatenate: ",%" PRId64 ""
-            (1 == nIterationCount) ? "" : ",",
-            it);
-    }
+    if (m_setData.empty()) { return false; }
 
-    return !m_setData.empty();
+    strOutput.Concatenate("%s", m_setData.Encode().c_str());
+
+    return true;
 }
 
+const IntervalSet& NumList::Numbers() const { return m_setData; }
+
 std::int32_t NumList::Count() const
 {
     return static_cast<std::int32_t>(m_setData.size());
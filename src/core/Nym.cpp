@@ -59,6 +59,9 @@
 
 namespace opentxs
 {
+std::atomic<std::uint64_t> Nym::verification_hits_{0};
+std::atomic<std::uint64_t> Nym::verification_misses_{0};
+
 Nym::Nym(
     const api::Core& api,
     const Identifier& nymID,
@@ -77,6 +80,8 @@ Nym::Nym(
     , m_mapCredentialSets()
     , m_mapRevokedSets()
     , m_listRevokedIDs()
+    , verified_index_()
+    , verified_(false)
 {
 }
 
@@ -1520,7 +1525,50 @@ bool Nym::VerifyPseudonym() const
     return verify_pseudonym(lock);
 }
 
+std::uint64_t Nym::VerificationCacheHits()
+{
+    return verification_hits_.load();
+}
+
+std::uint64_t Nym::VerificationCacheMisses()
+{
+    return verification_misses_.load();
+}
+
+std::string Nym::verification_key(const eLock& lock) const
+{
+    OT_ASSERT(verify_lock(lock));
+
+    std::string output = m_nymID->str();
+    output.append(std::to_string(revision_.load()));
+
+    for (const auto& it : m_mapCredentialSets) {
+        OT_ASSERT(nullptr != it.second);
+
+        output.append(proto::ProtoAsString(*it.second->Serialize(ONLY_IDS)));
+    }
+
+    return output;
+}
+
 bool Nym::verify_pseudonym(const eLock& lock) const
+{
+    auto key = verification_key(lock);
+
+    if (key == verified_index_) {
+        ++verification_hits_;
+
+        return verified_;
+    }
+
+    ++verification_misses_;
+    verified_ = verify_credentials(lock);
+    verified_index_.swap(key);
+
+    return verified_;
+}
+
+bool Nym::verify_credentials(const eLock& lock) const
 {
     // If there are credentials, then we verify the Nym via his credentials.
     if (!m_mapCredentialSets.empty()) {
@@ -28,6 +28,7 @@
 
 #include <irrxml/irrXML.hpp>
 #include <string.h>
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -60,6 +61,12 @@ OTCron::OTCron(const api::Core& server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_mapItemPositions()
+    , m_multimapSchedule()
+    , m_mapSchedulePositions()
+    , m_lastRoundProcessed(0)
+    , m_lastRoundRemoved(0)
+    , m_lastRoundMilliseconds(0)
     , m_NOTARY_ID(Identifier::Factory())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
@@ -558,7 +565,58 @@ void OTCron::UpdateContents()
 
 std::int64_t OTCron::computeTimeout()
 {
-    return OTCron::GetCronMsBetweenProcess() - tCron.getElapsedTimeInMilliSec();
+    const auto elapsed =
+        static_cast<std::int64_t>(tCron.getElapsedTimeInMilliSec());
+    // Cron item dates have a resolution of one second, so there is no point in
+    // running rounds more often than that.
+    const std::int64_t minimum = 1000 - elapsed;
+    const std::int64_t maximum = OTCron::GetCronMsBetweenProcess() - elapsed;
+
+    if (false == m_bIsActivated) { return OTCron::GetCronMsBetweenProcess(); }
+
+    if (m_multimapSchedule.empty()) { return std::max(minimum, maximum); }
+
+    const auto now = OTTimeGetCurrentTime();
+    const auto& due = m_multimapSchedule.begin()->first;
+    const std::int64_t untilDue =
+        (due > now) ? 1000 * OTTimeGetTimeInterval(due, now) : 0;
+
+    return std::max(minimum, std::min(untilDue, maximum));
+}
+
+// Items only do any work once more than their process interval has elapsed
+// since they were last processed, so there is no need to visit them earlier.
+time64_t OTCron::next_due(const OTCronItem& item, const time64_t& now) const
+{
+    const auto& last = item.GetLastProcessDate();
+    auto due = now;
+
+    if (last > OT_TIME_ZERO) {
+        due = OTTimeAddTimeInterval(last, item.GetProcessInterval() + 1);
+    }
+
+    const auto earliest = OTTimeAddTimeInterval(now, 1);
+
+    return (due < earliest) ? earliest : due;
+}
+
+void OTCron::schedule_item(
+    const std::int64_t lTransactionNum,
+    const time64_t& due)
+{
+    unschedule_item(lTransactionNum);
+    m_mapSchedulePositions.emplace(
+        lTransactionNum, m_multimapSchedule.emplace(due, lTransactionNum));
+}
+
+void OTCron::unschedule_item(const std::int64_t lTransactionNum)
+{
+    auto it = m_mapSchedulePositions.find(lTransactionNum);
+
+    if (m_mapSchedulePositions.end() == it) { return; }
+
+    m_multimapSchedule.erase(it->second);
+    m_mapSchedulePositions.erase(it);
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -573,6 +631,9 @@ void OTCron::ProcessCronItems()
     // check elapsed time since last items processing
     if (computeTimeout() > 0) { return; }
     tCron.start();
+    m_lastRoundProcessed = 0;
+    m_lastRoundRemoved = 0;
+    m_lastRoundMilliseconds = 0;
 
     const std::int32_t nTwentyPercent = OTCron::GetCronRefillAmount() / 5;
     if (GetTransactionCount() <= nTwentyPercent) {
@@ -590,12 +651,16 @@ void OTCron::ProcessCronItems()
         return;
     }
     bool bNeedToSave = false;
+    const auto now = OTTimeGetCurrentTime();
 
-    // loop through the cron items and tell each one to ProcessCron().
+    // Tell each item which is due to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    while (false == m_multimapSchedule.empty()) {
+        const auto next = m_multimapSchedule.begin();
+
+        if (next->first > now) { break; }
+
         if (GetTransactionCount() <= nTwentyPercent) {
             otErr << "WARNING: Cron has fewer than 20 percent of its normal "
                      "transaction "
@@ -611,28 +676,44 @@ void OTCron::ProcessCronItems()
                      "SCHEDULED FOR THIS ROUND!!!\n\n";
             break;
         }
-        auto pItem = it->second;
+
+        const auto lTransactionNum = next->second;
+        unschedule_item(lTransactionNum);
+        auto pItem = GetItemByOfficialNum(lTransactionNum);
         OT_ASSERT(false != bool(pItem));
         otInfo << "OTCron::" << __FUNCTION__
-               << ": Processing item number: " << pItem->GetTransactionNum()
-               << " \n";
+               << ": Processing item number: " << lTransactionNum << " \n";
+        ++m_lastRoundProcessed;
+        const bool keep = pItem->ProcessCron();
+        // Processing may have removed the item from cron already
+        auto it_map = FindItemOnMap(lTransactionNum);
+
+        if (m_mapCronItems.end() == it_map) { continue; }
 
-        if (pItem->ProcessCron()) {
-            it++;
+        if (keep) {
+            schedule_item(lTransactionNum, next_due(*pItem, now));
             continue;
         }
         pItem->HookRemovalFromCron(
             api_.Wallet(), nullptr, GetNextTransactionNumber());
         otOut << "OTCron::" << __FUNCTION__
-              << ": Removing cron item: " << pItem->GetTransactionNum() << "\n";
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
+              << ": Removing cron item: " << lTransactionNum << "\n";
+        auto it_multimap = FindItemOnMultimap(lTransactionNum);
+        OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+        m_multimapCronItems.erase(it_multimap);
+        m_mapItemPositions.erase(lTransactionNum);
         m_mapCronItems.erase(it_map);
+        ++m_lastRoundRemoved;
 
         bNeedToSave = true;
     }
     if (bNeedToSave) SaveCron();
+
+    m_lastRoundMilliseconds = tCron.getElapsedTimeInMilliSec();
+    otInfo << "OTCron::" << __FUNCTION__ << ": Processed "
+           << m_lastRoundProcessed << " of " << m_mapCronItems.size()
+           << " items, removed " << m_lastRoundRemoved << ", in "
+           << m_lastRoundMilliseconds << " ms\n";
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -685,10 +766,15 @@ bool OTCron::AddCronItem(
 
         // Insert to the MULTIMAP (by Date)
         //
-        m_multimapCronItems.insert(
-            m_multimapCronItems.upper_bound(tDateAdded),
-            std::pair<time64_t, std::shared_ptr<OTCronItem>>(
-                tDateAdded, theItem));
+        m_mapItemPositions.emplace(
+            theItem->GetTransactionNum(),
+            m_multimapCronItems.insert(
+                m_multimapCronItems.upper_bound(tDateAdded),
+                std::pair<time64_t, std::shared_ptr<OTCronItem>>(
+                    tDateAdded, theItem)));
+
+        // New items are due immediately.
+        schedule_item(theItem->GetTransactionNum(), OTTimeGetCurrentTime());
 
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
@@ -783,6 +869,8 @@ bool OTCron::RemoveCronItem(
 
         m_mapCronItems.erase(it_map);            // Remove from MAP.
         m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        m_mapItemPositions.erase(lTransactionNum);
+        unschedule_item(lTransactionNum);
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
@@ -830,16 +918,14 @@ mapOfCronItems::iterator OTCron::FindItemOnMap(std::int64_t lTransactionNum)
 multimapOfCronItems::iterator OTCron::FindItemOnMultimap(
     std::int64_t lTransactionNum)
 {
-    auto itt = m_multimapCronItems.begin();
+    auto it = m_mapItemPositions.find(lTransactionNum);
 
-    while (m_multimapCronItems.end() != itt) {
-        auto pItem = itt->second;
-        OT_ASSERT(false != bool(pItem));
-
-        if (pItem->GetTransactionNum() == lTransactionNum) break;
+    if (m_mapItemPositions.end() == it) { return m_multimapCronItems.end(); }
 
-        ++itt;
-    }
+    auto itt = it->second;
+    auto pItem = itt->second;
+    OT_ASSERT(false != bool(pItem));
+    OT_ASSERT(pItem->GetTransactionNum() == lTransactionNum);
 
     return itt;
 }
@@ -1059,7 +1059,7 @@ bool OTCronItem::DropFinalReceiptToInbox(
     // ...or generate it otherwise...
 
     if (true == bSuccessLoading)
-        bSuccessLoading = theInbox->VerifyAccount(pServerNym);
+        bSuccessLoading = theInbox->VerifyAbbreviated(pServerNym);
     else
         otErr << szFunc << ": ERROR loading inbox ledger.\n";
     //      otErr << szFunc << ": ERROR loading inbox ledger.\n";
@@ -1236,7 +1236,7 @@ bool OTCronItem::DropFinalReceiptToNymbox(
     // ...or generate it otherwise...
 
     if (true == bSuccessLoading)
-        bSuccessLoading = theLedger->VerifyAccount(*pServerNym);
+        bSuccessLoading = theLedger->VerifyAbbreviated(*pServerNym);
     else
         otErr << szFunc << ": Unable to load Nymbox.\n";
     //    else
@@ -173,7 +173,7 @@ bool OTAgreement::DropServerNoticeToNymbox(
     bool bSuccessLoading = theLedger->LoadNymbox();
 
     if (true == bSuccessLoading) {
-        bSuccessLoading = theLedger->VerifyAccount(theServerNym);
+        bSuccessLoading = theLedger->VerifyAbbreviated(theServerNym);
     } else {
         bSuccessLoading = theLedger->GenerateLedger(
             NYM_ID, NOTARY_ID, ledgerType::nymbox, true);  // bGenerateFile=true
@@ -816,7 +816,7 @@ bool OTPaymentPlan::ProcessPayment(
         //
         if (true == bSuccessLoadingSenderInbox)
             bSuccessLoadingSenderInbox =
-                theSenderInbox->VerifyAccount(*pServerNym);
+                theSenderInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingSenderInbox = theSenderInbox->GenerateLedger(
                 SOURCE_ACCT_ID,
@@ -826,7 +826,7 @@ bool OTPaymentPlan::ProcessPayment(
 
         if (true == bSuccessLoadingRecipientInbox)
             bSuccessLoadingRecipientInbox =
-                theRecipientInbox->VerifyAccount(*pServerNym);
+                theRecipientInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingRecipientInbox = theRecipientInbox->GenerateLedger(
                 RECIPIENT_ACCT_ID,
@@ -2484,7 +2484,7 @@ bool OTSmartContract::StashFunds(
 
         if (true == bSuccessLoadingPartyInbox)
             bSuccessLoadingPartyInbox =
-                thePartyInbox->VerifyAccount(*pServerNym);
+                thePartyInbox->VerifyAbbreviated(*pServerNym);
         else
             otErr << "OTSmartContract::StashFunds: Failed trying to load "
                      "party's inbox.\n";
@@ -5705,14 +5705,14 @@ bool OTSmartContract::MoveFunds(
 
         if (true == bSuccessLoadingSenderInbox)
             bSuccessLoadingSenderInbox =
-                theSenderInbox->VerifyAccount(*pServerNym);
+                theSenderInbox->VerifyAbbreviated(*pServerNym);
         else
             otErr << "OTCronItem::MoveFunds: ERROR loading sender inbox "
                      "ledger.\n";
 
         if (true == bSuccessLoadingRecipientInbox)
             bSuccessLoadingRecipientInbox =
-                theRecipientInbox->VerifyAccount(*pServerNym);
+                theRecipientInbox->VerifyAbbreviated(*pServerNym);
         else
             otErr << "OTCronItem::MoveFunds: ERROR loading recipient inbox "
                      "ledger.\n";
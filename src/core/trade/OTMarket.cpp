@@ -53,6 +53,8 @@ OTMarket::OTMarket(const api::Core& core, const char* szFilename)
     , m_mapBids()
     , m_mapAsks()
     , m_mapOffers()
+    , m_mapOfferPositions()
+    , m_lRevision(1)
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
     , m_CURRENCY_TYPE_ID(Identifier::Factory())
@@ -74,6 +76,8 @@ OTMarket::OTMarket(const api::Core& core)
     , m_mapBids()
     , m_mapAsks()
     , m_mapOffers()
+    , m_mapOfferPositions()
+    , m_lRevision(1)
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
     , m_CURRENCY_TYPE_ID(Identifier::Factory())
@@ -96,6 +100,8 @@ OTMarket::OTMarket(
     , m_mapBids()
     , m_mapAsks()
     , m_mapOffers()
+    , m_mapOfferPositions()
+    , m_lRevision(1)
     , m_NOTARY_ID(Identifier::Factory(NOTARY_ID))
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory(INSTRUMENT_DEFINITION_ID))
     , m_CURRENCY_TYPE_ID(Identifier::Factory(CURRENCY_TYPE_ID))
@@ -645,32 +651,20 @@ bool OTMarket::RemoveOffer(const std::int64_t& lTransactionNum)  // if false,
         // The code operates the same whether ask or bid. Just use a pointer.
         mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
 
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
+        // Each offer's position on the bid/ask list was recorded when it was
+        // added, so it can be erased directly instead of searching the list.
         OTOffer* pSameOffer = nullptr;
+        auto position = m_mapOfferPositions.find(lTransactionNum);
 
-        for (mapOfOffers::iterator iii = pMap->begin(); iii != pMap->end();
-             ++iii) {
-            pSameOffer = iii->second;
+        if (m_mapOfferPositions.end() != position) {
+            pSameOffer = position->second->second;
 
             OT_ASSERT_MSG(
                 nullptr != pSameOffer,
                 "nullptr offer pointer in OTMarket::RemoveOffer.\n");
 
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
+            pMap->erase(position->second);
+            m_mapOfferPositions.erase(position);
         }
 
         if (nullptr == pSameOffer) {
@@ -680,6 +674,7 @@ bool OTMarket::RemoveOffer(const std::int64_t& lTransactionNum)  // if false,
                 // well.
         {
             bReturnValue = true;  // Success.
+            ++m_lRevision;
         }
 
         // pOffer was found on the Offers list.
@@ -759,7 +754,7 @@ bool OTMarket::AddOffer(
             // No bother checking if the offer is already on this list,
             // since the code above basically already verifies that for us.
 
-            m_mapBids.insert(
+            m_mapOfferPositions[lTransactionNum] = m_mapBids.insert(
                 m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
                                                      // first, so I am last in
                                                      // line at lower bound.
@@ -768,7 +763,7 @@ bool OTMarket::AddOffer(
                 "Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
+            m_mapOfferPositions[lTransactionNum] = m_mapAsks.insert(
                 m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
                                                      // first, so I am last in
                                                      // line at upper bound.
@@ -778,6 +773,8 @@ bool OTMarket::AddOffer(
                 .Flush();
         }
 
+        ++m_lRevision;
+
         if (bSaveFile) {
             // Set this to the current date/time, since the offer is
             // being added for the first time.
@@ -931,31 +928,19 @@ std::int64_t OTMarket::GetHighestBidPrice()
 // on the market.
 std::int64_t OTMarket::GetLowestAskPrice()
 {
-    std::int64_t lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
+    // Market orders have a 0 price, so we need to skip any if they are
+    // here.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices. The asks are ordered by price, so the first non-zero
+    // price is found directly instead of walking past the market orders.
+    //
+    auto it = m_mapAsks.upper_bound(0);
 
-            if (it == m_mapAsks.end()) break;
+    if (it != m_mapAsks.end()) { return it->first; }
 
-            lPrice = it->first;
-        }
-    }
-
-    return lPrice;
+    return 0;
 }
 
 // This utility function is used directly below (only).
@@ -1321,7 +1306,7 @@ void OTMarket::ProcessTrade(
 
         if (true == bSuccessLoadingFirstAsset)
             bSuccessLoadingFirstAsset =
-                theFirstAssetInbox->VerifyAccount(*pServerNym);
+                theFirstAssetInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingFirstAsset = theFirstAssetInbox->GenerateLedger(
                 theTrade.GetSenderAcctID(),
@@ -1331,7 +1316,7 @@ void OTMarket::ProcessTrade(
 
         if (true == bSuccessLoadingFirstCurrency)
             bSuccessLoadingFirstCurrency =
-                theFirstCurrencyInbox->VerifyAccount(*pServerNym);
+                theFirstCurrencyInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingFirstCurrency =
                 theFirstCurrencyInbox->GenerateLedger(
@@ -1342,7 +1327,7 @@ void OTMarket::ProcessTrade(
 
         if (true == bSuccessLoadingOtherAsset)
             bSuccessLoadingOtherAsset =
-                theOtherAssetInbox->VerifyAccount(*pServerNym);
+                theOtherAssetInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingOtherAsset = theOtherAssetInbox->GenerateLedger(
                 pOtherTrade->GetSenderAcctID(),
@@ -1352,7 +1337,7 @@ void OTMarket::ProcessTrade(
 
         if (true == bSuccessLoadingOtherCurrency)
             bSuccessLoadingOtherCurrency =
-                theOtherCurrencyInbox->VerifyAccount(*pServerNym);
+                theOtherCurrencyInbox->VerifyAbbreviated(*pServerNym);
         else
             bSuccessLoadingOtherCurrency =
                 theOtherCurrencyInbox->GenerateLedger(
@@ -1905,6 +1890,7 @@ void OTMarket::ProcessTrade(
                 // that we just processed. Make sure to save the Market
                 // since it contains those offers that have just
                 // updated.
+                ++m_lRevision;
                 SaveMarket();
 
                 // The Trade has changed, and it is stored as a
@@ -2704,6 +2690,11 @@ void OTMarket::Release_Market()
         delete pOffer;
         pOffer = nullptr;
     }
+
+    // The offers themselves were deleted above.
+    m_mapOffers.clear();
+    m_mapOfferPositions.clear();
+    ++m_lRevision;
 }
 
 void OTMarket::Release()
@@ -50,6 +50,7 @@ OTTrade::OTTrade(const api::Core& core)
     , stopSign_(0)
     , stopActivated_(false)
     , tradesAlreadyDone_(0)
+    , marketRevision_(0)
     , marketOffer_(String::Factory())
 {
     InitTrade();
@@ -72,6 +73,7 @@ OTTrade::OTTrade(
     , stopSign_(0)
     , stopActivated_(false)
     , tradesAlreadyDone_(0)
+    , marketRevision_(0)
     , marketOffer_(String::Factory())
 {
     InitTrade();
@@ -1055,11 +1057,19 @@ bool OTTrade::ProcessCron()
             bStayOnMarket = false;  // I'm leaving the check here in case the
                                     // flag was set since then.
 
-        else  // Process it!  <===================
+        // A limit order which already failed to match against the current
+        // book can't match now either, so only re-evaluate it after the
+        // market has changed.
+        else if (
+            offer->IsLimitOrder() &&
+            (market->GetRevision() == marketRevision_)) {
+            bStayOnMarket = true;
+        } else  // Process it!  <===================
         {
             otInfo << "Processing trade: " << GetTransactionNum() << ".\n";
 
             bStayOnMarket = market->ProcessTrade(api_.Wallet(), *this, *offer);
+            marketRevision_ = market->GetRevision();
             // No need to save the Trade or Offer, since they will
             // be saved inside this call if they are changed.
         }
@@ -34,13 +34,18 @@
 #include "opentxs/Proto.hpp"
 
 #include <atomic>
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "ServerConnection.hpp"
 
@@ -93,14 +98,19 @@ ServerConnection::ServerConnection(
     , socket_ready_(Flag::Factory(false))
     , status_(Flag::Factory(false))
     , use_proxy_(Flag::Factory(false))
-    , incoming_lock_()
-    , incoming_()
+    , raw_supported_(Flag::Factory(false))
+    , running_(Flag::Factory(true))
+    , pending_lock_()
+    , pending_cv_()
+    , pending_()
+    , timeout_thread_()
     , registation_lock_()
     , registered_for_push_()
 {
     OT_ASSERT(remote_contract_)
 
     thread_ = std::thread(&ServerConnection::activity_timer, this);
+    timeout_thread_ = std::thread(&ServerConnection::expire_requests, this);
     const auto started = notification_socket_->Start(
         api_.Endpoints().InternalProcessPushNotification());
 
@@ -157,6 +167,11 @@ bool ServerConnection::ClearProxy()
     return true;
 }
 
+std::shared_ptr<Message> ServerConnection::empty_reply() const
+{
+    return std::shared_ptr<Message>(api_.Factory().Message().release());
+}
+
 bool ServerConnection::EnableProxy()
 {
     Lock lock(lock_);
@@ -210,6 +225,62 @@ std::string ServerConnection::form_endpoint(
     return output;
 }
 
+void ServerConnection::expire_requests()
+{
+    while (running_.get()) {
+        std::vector<Pending> expired{};
+        Lock lock(pending_lock_);
+        const auto now = std::chrono::system_clock::now();
+        const bool shutdown = (false == zmq_.Running());
+        auto next = now + std::chrono::seconds(1);
+
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            auto& pending = it->second;
+
+            if (shutdown || (now >= pending.deadline_)) {
+                expired.emplace_back(std::move(pending));
+                it = pending_.erase(it);
+            } else {
+                next = std::min(next, pending.deadline_);
+                ++it;
+            }
+        }
+
+        if (expired.empty()) {
+            pending_cv_.wait_until(lock, next);
+
+            continue;
+        }
+
+        lock.unlock();
+        const auto status = shutdown ? SendResult::ERROR : SendResult::TIMEOUT;
+
+        for (auto& pending : expired) {
+            pending.promise_.set_value({status, empty_reply()});
+        }
+
+        if (false == shutdown) { reset_socket_if_idle(); }
+    }
+}
+
+bool ServerConnection::finish(
+    const RequestID& id,
+    const SendResult status,
+    const std::shared_ptr<Message>& reply)
+{
+    Lock lock(pending_lock_);
+    auto it = pending_.find(id);
+
+    if (pending_.end() == it) { return false; }
+
+    auto promise = std::move(it->second.promise_);
+    pending_.erase(it);
+    lock.unlock();
+    promise.set_value({status, reply});
+
+    return true;
+}
+
 zeromq::DealerSocket& ServerConnection::get_socket(const Lock& lock)
 {
     OT_ASSERT(verify_lock(lock))
@@ -222,12 +293,6 @@ zeromq::DealerSocket& ServerConnection::get_socket(const Lock& lock)
     return socket_;
 }
 
-std::chrono::time_point<std::chrono::system_clock> ServerConnection::
-    get_timeout()
-{
-    return std::chrono::system_clock::now() + zmq_.SendTimeout();
-}
-
 void ServerConnection::process_incoming(const proto::ServerReply& in)
 {
     auto message = otx::Reply::Factory(api_, in);
@@ -261,7 +326,10 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
 
     if (0 == frame.size()) { return; }
 
-    if (1 < in.Body().size()) {
+    auto encoding{LegacyEncoding::ARMORED};
+    const bool encoded = read_legacy_encoding(in, encoding);
+
+    if ((1 < in.Body().size()) && (false == encoded)) {
         const auto [isProto, reply] = check_for_protobuf(frame);
 
         if (isProto) {
@@ -277,12 +345,29 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
         return;
     }
 
-    Armored armored{};
-    armored.Set(std::string(frame).c_str());
     auto serialized = String::Factory();
-    armored.GetString(serialized);
+
+    if (LegacyEncoding::RAW == encoding) {
+        if (frame.size() >= (MAX_STRING_LENGTH - 10)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Reply is too large."
+                  << std::endl;
+
+            return;
+        }
+
+        raw_supported_->On();
+        serialized = String::Factory(
+            static_cast<const char*>(frame.data()), frame.size());
+    } else {
+        Armored armored{};
+        armored.Set(std::string(frame).c_str());
+        armored.GetString(serialized);
+    }
+
     const auto loaded = message->LoadContractFromString(serialized);
-    const RequestNumber number = message->m_strRequestNum->ToLong();
+    const RequestID id{message->m_strNymID->Get(),
+                       message->m_strRequestNum->ToLong()};
+    const auto& [nym, number] = id;
 
     if (0 > number) {
         otErr << OT_METHOD << __FUNCTION__
@@ -291,15 +376,29 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
         return;
     }
 
-    Lock lock(incoming_lock_);
-    auto& reply = incoming_[number];
+    bool pending{false};
 
     if (loaded) {
-        reply.reset(message.release());
+        pending = finish(
+            id,
+            SendResult::VALID_REPLY,
+            std::shared_ptr<Message>(message.release()));
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Received server reply, "
               << "but unable to instantiate it as a Message." << std::endl;
-        reply.reset();
+        // If the reply is too damaged to identify its request, that request
+        // is left for the timeout to fail
+        pending = finish(id, SendResult::INVALID_REPLY, nullptr);
+
+        if (pending) { reset_socket_if_idle(); }
+    }
+
+    if (pending) {
+        reset_timer();
+    } else {
+        otInfo << OT_METHOD << __FUNCTION__ << ": Discarding reply to request "
+               << number << " for nym " << nym << " which is no longer pending."
+               << std::endl;
     }
 }
 
@@ -345,6 +444,16 @@ void ServerConnection::reset_socket(const Lock& lock)
     socket_ready_->Off();
 }
 
+// This also runs on the socket's own callback, so it must not block on lock_
+// while another thread replaces the socket. Requests are registered under
+// pending_lock_ before they are sent, so none can be using the old socket.
+void ServerConnection::reset_socket_if_idle()
+{
+    Lock lock(pending_lock_);
+
+    if (pending_.empty()) { socket_ready_->Off(); }
+}
+
 void ServerConnection::reset_timer()
 {
     last_activity_.store(std::time(nullptr));
@@ -354,58 +463,78 @@ NetworkReplyMessage ServerConnection::Send(
     const ServerContext& context,
     const Message& message)
 {
-    register_for_push(context);
-    NetworkReplyMessage output{SendResult::ERROR, nullptr};
-    auto& status = output.first;
-    auto& reply = output.second;
-    reply.reset(api_.Factory().Message().release());
-
-    OT_ASSERT(false != bool(reply));
+    return SendAsync(
+               context,
+               message,
+               std::chrono::duration_cast<std::chrono::milliseconds>(
+                   zmq_.SendTimeout()))
+        .get();
+}
 
+std::future<NetworkReplyMessage> ServerConnection::SendAsync(
+    const ServerContext& context,
+    const Message& message,
+    const std::chrono::milliseconds& timeout)
+{
+    register_for_push(context);
+    std::promise<NetworkReplyMessage> promise{};
+    auto output = promise.get_future();
     auto raw = String::Factory();
     message.SaveContractRaw(raw);
-    Armored envelope(raw);
-
-    if (false == envelope.Exists()) { return output; }
-
-    Lock socketLock(lock_);
-    auto request = zmq::Message::Factory(std::string(envelope.Get()));
-    request->EnsureDelimiter();
-    auto sent = get_socket(socketLock).Send(request);
+    // Notaries which do not understand the encoding frame ignore it and
+    // answer with an armored reply, so offering it is always safe
+    const bool offerRaw = zmq_.RawTransport();
+    const bool sendRaw = offerRaw && raw_supported_.get();
+    std::string payload{};
+
+    if (sendRaw) {
+        payload.assign(raw->Get(), raw->GetLength());
+    } else {
+        Armored envelope(raw);
 
-    if (false == sent) { return output; }
+        if (envelope.Exists()) { payload.assign(envelope.Get()); }
+    }
 
-    const auto limit = get_timeout();
-    const RequestNumber number = message.m_strRequestNum->ToLong();
+    if (payload.empty()) {
+        promise.set_value({SendResult::ERROR, empty_reply()});
 
-    while (zmq_.Running() && (std::chrono::system_clock::now() < limit)) {
-        Lock mapLock(incoming_lock_);
-        auto it = incoming_.find(number);
+        return output;
+    }
 
-        if (incoming_.end() != it) {
-            reply.reset(it->second.release());
+    const RequestID id{message.m_strNymID->Get(),
+                       message.m_strRequestNum->ToLong()};
+    Lock pendingLock(pending_lock_);
 
-            if (reply) {
-                status = SendResult::VALID_REPLY;
-            } else {
-                status = SendResult::INVALID_REPLY;
-                reset_socket(socketLock);
-            }
+    if (0 < pending_.count(id)) {
+        pendingLock.unlock();
+        otErr << OT_METHOD << __FUNCTION__ << ": Request " << id.second
+              << " for nym " << id.first << " is already in flight."
+              << std::endl;
+        promise.set_value({SendResult::ERROR, empty_reply()});
 
-            incoming_.erase(it);
-            reset_timer();
+        return output;
+    }
 
-            return output;
-        }
+    // Register before sending so a fast reply always finds its waiter
+    auto& pending = pending_[id];
+    pending.promise_ = std::move(promise);
+    pending.deadline_ = std::chrono::system_clock::now() + timeout;
+    pendingLock.unlock();
+    pending_cv_.notify_all();
+    auto request = zmq::Message::Factory();
+    request->AddFrame(std::move(payload));
+    request->EnsureDelimiter();
 
-        mapLock.unlock();
-        Log::Sleep(std::chrono::milliseconds(5));
+    if (offerRaw) {
+        const auto encoding =
+            sendRaw ? LegacyEncoding::RAW : LegacyEncoding::ARMORED;
+        request->AddFrame(Data::Factory(&encoding, sizeof(encoding)));
     }
+    Lock socketLock(lock_);
+    const auto sent = get_socket(socketLock).Send(request);
+    socketLock.unlock();
 
-    if (zmq_.Running()) {
-        status = SendResult::TIMEOUT;
-        reset_socket(socketLock);
-    }
+    if (false == sent) { finish(id, SendResult::ERROR, empty_reply()); }
 
     return output;
 }
@@ -466,6 +595,19 @@ bool ServerConnection::Status() const { return status_.get(); }
 
 ServerConnection::~ServerConnection()
 {
+    running_->Off();
+    pending_cv_.notify_all();
+
+    if (timeout_thread_.joinable()) { timeout_thread_.join(); }
+
     if (thread_.joinable()) { thread_.join(); }
+
+    Lock lock(pending_lock_);
+
+    for (auto& it : pending_) {
+        it.second.promise_.set_value({SendResult::ERROR, empty_reply()});
+    }
+
+    pending_.clear();
 }
 }  // namespace opentxs::network::implementation
@@ -19,6 +19,10 @@ public:
     NetworkReplyMessage Send(
         const ServerContext& context,
         const Message& message) override;
+    std::future<NetworkReplyMessage> SendAsync(
+        const ServerContext& context,
+        const Message& message,
+        const std::chrono::milliseconds& timeout) override;
     bool Status() const override;
 
     ~ServerConnection();
@@ -26,6 +30,15 @@ public:
 private:
     friend opentxs::network::ServerConnection;
 
+    struct Pending {
+        std::promise<NetworkReplyMessage> promise_{};
+        std::chrono::time_point<std::chrono::system_clock> deadline_{};
+    };
+
+    // Every nym using this notary shares the connection, and request numbers
+    // are only unique per nym
+    using RequestID = std::pair<std::string, RequestNumber>;
+
     const api::network::ZMQ& zmq_;
     const api::Core& api_;
     const zeromq::PublishSocket& updates_;
@@ -40,8 +53,13 @@ private:
     OTFlag socket_ready_;
     OTFlag status_;
     OTFlag use_proxy_;
-    std::mutex incoming_lock_;
-    std::map<RequestNumber, std::unique_ptr<Message>> incoming_;
+    // Set once the notary has answered with an unarmored message
+    OTFlag raw_supported_;
+    OTFlag running_;
+    std::mutex pending_lock_;
+    std::condition_variable pending_cv_;
+    std::map<RequestID, Pending> pending_;
+    std::thread timeout_thread_;
     mutable std::mutex registation_lock_;
     std::map<OTIdentifier, bool> registered_for_push_;
 
@@ -49,12 +67,12 @@ private:
         const zeromq::Frame& frame);
 
     ServerConnection* clone() const override { return nullptr; }
+    std::shared_ptr<Message> empty_reply() const;
     std::string endpoint() const;
     std::string form_endpoint(
         proto::AddressType type,
         std::string hostname,
         std::uint32_t port) const;
-    std::chrono::time_point<std::chrono::system_clock> get_timeout();
     void publish() const;
     void set_curve(const Lock& lock, zeromq::DealerSocket& socket) const;
     void set_proxy(const Lock& lock, zeromq::DealerSocket& socket) const;
@@ -62,11 +80,17 @@ private:
     OTZMQDealerSocket socket(const Lock& lock) const;
 
     void activity_timer();
+    void expire_requests();
+    bool finish(
+        const RequestID& id,
+        const SendResult status,
+        const std::shared_ptr<Message>& reply);
     zeromq::DealerSocket& get_socket(const Lock& lock);
     void process_incoming(const zeromq::Message& in);
     void process_incoming(const proto::ServerReply& in);
     void register_for_push(const ServerContext& context);
     void reset_socket(const Lock& lock);
+    void reset_socket_if_idle();
     void reset_timer();
 
     ServerConnection(
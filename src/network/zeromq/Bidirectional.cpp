@@ -19,8 +19,8 @@
 
 #include "Bidirectional.hpp"
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define POLL_MILLISECONDS 1000
+#include <thread>
+
 #define INPROC_PREFIX "inproc://opentxs/"
 
 #define OT_METHOD "opentxs::network::zeromq::implementation::Bidirectional::"
@@ -32,7 +32,7 @@ Bidirectional::Bidirectional(
     std::mutex& lock,
     void* socket,
     const bool startThread)
-    : Receiver(lock, socket, false)
+    : Receiver(context, lock, socket, false)
     , push_socket_{zmq_socket(context, ZMQ_PUSH)}
     , endpoint_{INPROC_PREFIX}
     , pull_socket_{zmq_socket(context, ZMQ_PULL)}
@@ -50,9 +50,7 @@ Bidirectional::Bidirectional(
 
     OT_ASSERT(false != connected);
 
-    if (startThread) {
-        receiver_thread_ = std::thread(&Bidirectional::thread, this);
-    }
+    if (startThread) { start_receiver(); }
 }
 
 bool Bidirectional::apply_timeouts(void* socket, std::mutex& socket_mutex) const
@@ -114,10 +112,7 @@ bool Bidirectional::connect(
 
 bool Bidirectional::process_pull_socket()
 {
-    Lock lock(receiver_lock_, std::try_to_lock);
-
-    if (!lock.owns_lock()) { return false; }
-
+    Lock lock(receiver_lock_);
     auto msg = Message::Factory();
     const auto received = Socket::receive_message(lock, pull_socket_, msg);
 
@@ -130,10 +125,7 @@ bool Bidirectional::process_pull_socket()
 
 bool Bidirectional::process_receiver_socket()
 {
-    Lock lock(receiver_lock_, std::try_to_lock);
-
-    if (!lock.owns_lock()) { return false; }
-
+    Lock lock(receiver_lock_);
     auto reply = Message::Factory();
     const auto received =
         Socket::receive_message(lock, receiver_socket_, reply);
@@ -160,55 +152,38 @@ bool Bidirectional::send(const Lock& lock, zeromq::Message& message)
     return Socket::send_message(lock, receiver_socket_, message);
 }
 
-void Bidirectional::thread()
+void Bidirectional::receive(void* socket)
 {
-    otInfo << OT_METHOD << __FUNCTION__ << ": Starting listener" << std::endl;
-
-    while (receiver_run_.get()) {
-        if (have_callback()) { break; }
+    if (false == have_callback()) {
+        std::this_thread::yield();
 
-        Log::Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
+        return;
     }
 
-    otInfo << OT_METHOD << __FUNCTION__ << ": Callback ready" << std::endl;
-    zmq_pollitem_t poll[2];
-
-    while (receiver_run_.get()) {
-        poll[0].socket = receiver_socket_;
-        poll[0].events = ZMQ_POLLIN;
-        poll[1].socket = pull_socket_;
-        poll[1].events = ZMQ_POLLIN;
-        const auto events = zmq_poll(poll, 2, POLL_MILLISECONDS);
-
-        if (0 == events) {
-            otInfo << OT_METHOD << __FUNCTION__ << ": No messages."
-                   << std::endl;
-
-            continue;
-        }
-
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Poll error: " << zmq_strerror(error) << std::endl;
-
-            continue;
-        }
+    if (receiver_socket_ == socket) {
+        process_receiver_socket();
+    } else if (pull_socket_ == socket) {
+        process_pull_socket();
+    }
+}
 
-        bool processed = true;
-        if (ZMQ_POLLIN == poll[0].revents) {
-            processed = process_receiver_socket();
-        }
+std::vector<void*> Bidirectional::receiver_sockets() const
+{
+    return {receiver_socket_, pull_socket_};
+}
 
-        if (false != processed && ZMQ_POLLIN == poll[1].revents) {
-            processed = process_pull_socket();
-        }
+Bidirectional::~Bidirectional()
+{
+    stop_receiver();
 
-        if (false == processed) { return; }
+    if (nullptr != push_socket_) {
+        zmq_close(push_socket_);
+        push_socket_ = nullptr;
     }
 
-    otInfo << OT_METHOD << __FUNCTION__ << ": Shutting down" << std::endl;
+    if (nullptr != pull_socket_) {
+        zmq_close(pull_socket_);
+        pull_socket_ = nullptr;
+    }
 }
-
-Bidirectional::~Bidirectional() {}
 }  // namespace opentxs::network::zeromq::implementation
@@ -7,14 +7,13 @@
 
 #include "Internal.hpp"
 
-#include "opentxs/core/Flag.hpp"
 #include "opentxs/Types.hpp"
 
 #include "Receiver.hpp"
 
-#include <memory>
 #include <mutex>
-#include <thread>
+#include <string>
+#include <vector>
 
 namespace opentxs::network::zeromq::implementation
 {
@@ -48,8 +47,9 @@ private:
         const;
     bool process_pull_socket();
     bool process_receiver_socket();
+    void receive(void* socket) override;
+    std::vector<void*> receiver_sockets() const override;
     bool send(const Lock& lock, zeromq::Message& message);
-    void thread() override;
 
     Bidirectional() = delete;
     Bidirectional(const Bidirectional&) = delete;
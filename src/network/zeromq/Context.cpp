@@ -22,9 +22,12 @@
 #include "opentxs/network/zeromq/SubscribeSocket.hpp"
 
 #include "PairEventListener.hpp"
+#include "Reactor.hpp"
 
 #include <zmq.h>
 
+#include <algorithm>
+#include <thread>
 #include <vector>
 
 template class opentxs::Pimpl<opentxs::network::zeromq::Context>;
@@ -92,9 +95,18 @@ namespace opentxs::network::zeromq::implementation
 {
 Context::Context()
     : context_(zmq_ctx_new())
+    , reactor_(nullptr)
 {
     OT_ASSERT(nullptr != context_);
     OT_ASSERT(1 == zmq_has("curve"));
+
+    // Callbacks may block (for example a reply socket waiting on the notary)
+    // so the pool is sized to keep every core busy.
+    reactor_.reset(new Reactor(
+        context_,
+        std::max<std::size_t>(2, std::thread::hardware_concurrency())));
+
+    OT_ASSERT(reactor_);
 }
 
 Context::operator void*() const
@@ -188,6 +200,14 @@ OTZMQPushSocket Context::PushSocket(const Socket::Direction direction) const
     return PushSocket::Factory(*this, direction);
 }
 
+bool Context::RegisterReceiver(
+    const void* owner,
+    const std::vector<void*>& sockets,
+    const ReceiveCallback& callback) const
+{
+    return reactor_->Register(owner, sockets, callback);
+}
+
 OTZMQReplySocket Context::ReplySocket(
     const ReplyCallback& callback,
     const Socket::Direction direction) const
@@ -213,8 +233,15 @@ OTZMQSubscribeSocket Context::SubscribeSocket(
     return SubscribeSocket::Factory(*this, callback);
 }
 
+void Context::UnregisterReceiver(const void* owner) const
+{
+    reactor_->Unregister(owner);
+}
+
 Context::~Context()
 {
+    reactor_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
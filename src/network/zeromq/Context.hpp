@@ -9,8 +9,12 @@
 
 #include "opentxs/network/zeromq/Context.hpp"
 
+#include <memory>
+
 namespace opentxs::network::zeromq::implementation
 {
+class Reactor;
+
 class Context : virtual public zeromq::Context
 {
 public:
@@ -50,6 +54,10 @@ public:
         const Socket::Direction direction) const override;
     OTZMQPushSocket PushSocket(
         const Socket::Direction direction) const override;
+    bool RegisterReceiver(
+        const void* owner,
+        const std::vector<void*>& sockets,
+        const ReceiveCallback& callback) const override;
     OTZMQReplySocket ReplySocket(
         const ReplyCallback& callback,
         const Socket::Direction direction) const override;
@@ -59,6 +67,7 @@ public:
         const Socket::Direction direction) const override;
     OTZMQSubscribeSocket SubscribeSocket(
         const ListenCallback& callback) const override;
+    void UnregisterReceiver(const void* owner) const override;
 
     ~Context();
 
@@ -66,6 +75,7 @@ private:
     friend network::zeromq::Context;
 
     void* context_{nullptr};
+    std::unique_ptr<Reactor> reactor_;
 
     Context* clone() const override;
 
@@ -13,8 +13,14 @@
 
 #include <zmq.h>
 
+#include <utility>
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Frame>;
 
+// Below this size copying the payload is cheaper than the extra allocations
+// needed to hand a buffer to zmq
+#define ZERO_COPY_THRESHOLD 256
+
 namespace opentxs::network::zeromq
 {
 OTZMQFrame Frame::Factory() { return OTZMQFrame(new implementation::Frame()); }
@@ -28,6 +34,11 @@ OTZMQFrame Frame::Factory(const std::string& input)
 {
     return OTZMQFrame(new implementation::Frame(input));
 }
+
+OTZMQFrame Frame::Factory(std::string&& input)
+{
+    return OTZMQFrame(new implementation::Frame(std::move(input)));
+}
 }  // namespace opentxs::network::zeromq
 
 namespace opentxs::network::zeromq::implementation
@@ -77,6 +88,54 @@ Frame::Frame(const std::string& input)
     OT_ASSERT(0 == init);
 }
 
+Frame::Frame(std::string&& input)
+    : message_(new zmq_msg_t)
+{
+    OT_ASSERT(nullptr != message_);
+
+    if (ZERO_COPY_THRESHOLD > input.size()) {
+        const auto init = zmq_msg_init_size(message_, input.size());
+
+        OT_ASSERT(0 == init);
+
+        OTPassword::safe_memcpy(
+            zmq_msg_data(message_),
+            zmq_msg_size(message_),
+            input.data(),
+            input.size(),
+            false);
+
+        return;
+    }
+
+    // zmq takes ownership of the string and releases it once the last copy
+    // of this message has been sent or closed
+    auto* buffer = new std::string(std::move(input));
+
+    OT_ASSERT(nullptr != buffer);
+
+    const auto init = zmq_msg_init_data(
+        message_, &(*buffer)[0], buffer->size(), &release_string, buffer);
+
+    OT_ASSERT(0 == init);
+}
+
+Frame::Frame(const Frame& rhs)
+    : zeromq::Frame()
+    , message_(new zmq_msg_t)
+{
+    OT_ASSERT(nullptr != message_);
+
+    auto init = zmq_msg_init(message_);
+
+    OT_ASSERT(0 == init);
+
+    // Shares the reference-counted payload instead of copying it
+    init = zmq_msg_copy(message_, rhs.message_);
+
+    OT_ASSERT(0 == init);
+}
+
 Frame::operator zmq_msg_t*() { return message_; }
 
 Frame::operator std::string() const
@@ -86,7 +145,7 @@ Frame::operator std::string() const
     return output;
 }
 
-Frame* Frame::clone() const { return new Frame(std::string(*this)); }
+Frame* Frame::clone() const { return new Frame(*this); }
 
 const void* Frame::data() const
 {
@@ -95,6 +154,11 @@ const void* Frame::data() const
     return zmq_msg_data(message_);
 }
 
+void Frame::release_string(void*, void* hint)
+{
+    delete static_cast<std::string*>(hint);
+}
+
 std::size_t Frame::size() const
 {
     OT_ASSERT(nullptr != message_);
@@ -104,6 +168,10 @@ std::size_t Frame::size() const
 
 Frame::~Frame()
 {
-    if (nullptr != message_) { zmq_msg_close(message_); }
+    if (nullptr != message_) {
+        zmq_msg_close(message_);
+        delete message_;
+        message_ = nullptr;
+    }
 }
 }  // namespace opentxs::network::zeromq::implementation
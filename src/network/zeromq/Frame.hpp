@@ -28,12 +28,15 @@ private:
 
     zmq_msg_t* message_{nullptr};
 
+    static void release_string(void* data, void* hint);
+
     Frame* clone() const override;
 
     Frame();
     explicit Frame(const Data& input);
     explicit Frame(const std::string& input);
-    Frame(const Frame&) = delete;
+    explicit Frame(std::string&& input);
+    Frame(const Frame& rhs);
     Frame(Frame&&) = delete;
     Frame& operator=(Frame&&) = delete;
     Frame& operator=(const Frame&) = delete;
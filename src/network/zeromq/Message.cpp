@@ -14,6 +14,8 @@
 
 #include "Message.hpp"
 
+#include <utility>
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Message>;
 
 namespace opentxs::network::zeromq
@@ -50,7 +52,9 @@ OTZMQMessage Message::ReplyFactory(const Message& request)
     auto output = new implementation::Message();
 
     if (0 < request.Header().size()) {
-        for (const auto& frame : request.Header()) { output->AddFrame(frame); }
+        for (const auto& frame : request.Header()) {
+            output->messages_.emplace_back(frame);
+        }
 
         output->AddFrame();
     }
@@ -97,6 +101,14 @@ Frame& Message::AddFrame(const std::string& input)
     return messages_.back().get();
 }
 
+Frame& Message::AddFrame(std::string&& input)
+{
+    OTZMQFrame message = Frame::Factory(std::move(input));
+
+    messages_.emplace_back(message);
+    return messages_.back().get();
+}
+
 const Frame& Message::at(const std::size_t index) const
 {
     OT_ASSERT(messages_.size() > index);
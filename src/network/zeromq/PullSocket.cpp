@@ -47,7 +47,7 @@ PullSocket::PullSocket(
     const bool startThread)
     : ot_super(context, SocketType::Pull, direction)
     , CurveServer(lock_, socket_)
-    , Receiver(lock_, socket_, startThread)
+    , Receiver(context, lock_, socket_, startThread)
     , callback_(callback)
 {
 }
@@ -0,0 +1,305 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
+
+#include <zmq.h>
+
+#include "Reactor.hpp"
+
+#include <cerrno>
+
+#define REACTOR_ENDPOINT_PREFIX "inproc://opentxs/reactor/"
+#define REACTOR_STALL_MILLISECONDS 100
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+Reactor::Reactor(void* context, const std::size_t workers)
+    : lock_()
+    , wake_lock_()
+    , state_changed_()
+    , task_ready_()
+    , running_(true)
+    , groups_()
+    , tasks_()
+    , idle_(0)
+    , last_taken_(std::chrono::steady_clock::now())
+    , generation_(0)
+    , poll_generation_(0)
+    , wake_pull_(zmq_socket(context, ZMQ_PULL))
+    , wake_push_(zmq_socket(context, ZMQ_PUSH))
+    , poller_()
+    , workers_()
+{
+    OT_ASSERT(nullptr != wake_pull_);
+    OT_ASSERT(nullptr != wake_push_);
+    OT_ASSERT(0 < workers);
+
+    const int linger{0};
+    zmq_setsockopt(wake_pull_, ZMQ_LINGER, &linger, sizeof(linger));
+    zmq_setsockopt(wake_push_, ZMQ_LINGER, &linger, sizeof(linger));
+    const std::string endpoint =
+        std::string(REACTOR_ENDPOINT_PREFIX) + Identifier::Random()->str();
+
+    const auto bound = zmq_bind(wake_pull_, endpoint.c_str());
+
+    OT_ASSERT(0 == bound);
+
+    const auto connected = zmq_connect(wake_push_, endpoint.c_str());
+
+    OT_ASSERT(0 == connected);
+
+    poller_ = std::thread(&Reactor::poll, this);
+
+    for (std::size_t i = 0; i < workers; ++i) {
+        workers_.emplace_back(&Reactor::work, this);
+    }
+}
+
+void Reactor::drain_wakeups()
+{
+    char buffer[1]{};
+
+    while (-1 != zmq_recv(wake_pull_, buffer, sizeof(buffer), ZMQ_DONTWAIT)) {
+        ;
+    }
+}
+
+void Reactor::poll()
+{
+    std::vector<zmq_pollitem_t> items{};
+    std::vector<const void*> owners{};
+
+    while (running_.load()) {
+        long timeout{-1};
+        items.clear();
+        owners.clear();
+        items.push_back({wake_pull_, 0, ZMQ_POLLIN, 0});
+        owners.push_back(nullptr);
+
+        {
+            Lock lock(lock_);
+
+            for (const auto& [owner, group] : groups_) {
+                if ((false == group.active_) || group.busy_) { continue; }
+
+                for (auto* socket : group.sockets_) {
+                    items.push_back({socket, 0, ZMQ_POLLIN, 0});
+                    owners.push_back(owner);
+                }
+            }
+
+            poll_generation_ = generation_;
+
+            // Waiting tasks are checked again shortly in case every worker
+            // is blocked
+            if (false == tasks_.empty()) {
+                timeout = REACTOR_STALL_MILLISECONDS;
+            }
+        }
+
+        state_changed_.notify_all();
+        const auto events = zmq_poll(items.data(), items.size(), timeout);
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+
+            if (ETERM == error) { break; }
+
+            if (EINTR != error) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+            }
+
+            continue;
+        }
+
+        if (0 != (items[0].revents & ZMQ_POLLIN)) { drain_wakeups(); }
+
+        bool queued{false};
+        bool grow{false};
+
+        {
+            Lock lock(lock_);
+
+            for (std::size_t i = 1; i < items.size(); ++i) {
+                if (0 == (items[i].revents & ZMQ_POLLIN)) { continue; }
+
+                auto it = groups_.find(owners[i]);
+
+                if (groups_.end() == it) { continue; }
+
+                auto& group = it->second;
+
+                if ((false == group.active_) || group.busy_) { continue; }
+
+                group.busy_ = true;
+                tasks_.emplace_back(owners[i], items[i].socket);
+                queued = true;
+            }
+
+            const auto waited = std::chrono::steady_clock::now() - last_taken_;
+            grow = (false == tasks_.empty()) && (0 == idle_) &&
+                   (waited >=
+                    std::chrono::milliseconds(REACTOR_STALL_MILLISECONDS));
+
+            if (grow) { last_taken_ = std::chrono::steady_clock::now(); }
+        }
+
+        if (grow) {
+            otWarn << OT_METHOD << __FUNCTION__ << ": Every worker is busy. "
+                   << "Adding worker " << (workers_.size() + 1) << std::endl;
+            workers_.emplace_back(&Reactor::work, this);
+        }
+
+        if (queued) { task_ready_.notify_all(); }
+    }
+}
+
+bool Reactor::Register(
+    const void* owner,
+    const std::vector<void*>& sockets,
+    const zeromq::Context::ReceiveCallback& callback)
+{
+    if ((nullptr == owner) || sockets.empty() || (false == bool(callback))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid registration"
+              << std::endl;
+
+        return false;
+    }
+
+    Lock lock(lock_);
+
+    if (0 < groups_.count(owner)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Already registered"
+              << std::endl;
+
+        return false;
+    }
+
+    auto& group = groups_[owner];
+    group.sockets_ = sockets;
+    group.callback_ = callback;
+    ++generation_;
+    lock.unlock();
+    wake();
+
+    return true;
+}
+
+void Reactor::Unregister(const void* owner)
+{
+    Lock lock(lock_);
+    auto it = groups_.find(owner);
+
+    if (groups_.end() == it) { return; }
+
+    auto& group = it->second;
+    group.active_ = false;
+
+    // A callback which unregisters its own group must not wait for itself
+    if (std::this_thread::get_id() != group.worker_) {
+        state_changed_.wait(lock, [&group]() -> bool { return !group.busy_; });
+    }
+
+    groups_.erase(it);
+    const auto generation = ++generation_;
+    lock.unlock();
+    wake();
+    lock.lock();
+
+    // The caller is about to close these sockets, so they must no longer be
+    // in the poll set when this function returns
+    state_changed_.wait(lock, [this, generation]() -> bool {
+        return (false == running_.load()) || (poll_generation_ >= generation);
+    });
+}
+
+void Reactor::wake()
+{
+    Lock lock(wake_lock_);
+    zmq_send(wake_push_, "", 0, ZMQ_DONTWAIT);
+}
+
+void Reactor::work()
+{
+    while (true) {
+        Task task{nullptr, nullptr};
+        zeromq::Context::ReceiveCallback callback{};
+
+        {
+            Lock lock(lock_);
+            ++idle_;
+            task_ready_.wait(lock, [this]() -> bool {
+                return (false == running_.load()) || (false == tasks_.empty());
+            });
+            --idle_;
+
+            if (false == running_.load()) { return; }
+
+            task = tasks_.front();
+            tasks_.pop_front();
+            last_taken_ = std::chrono::steady_clock::now();
+            auto it = groups_.find(task.first);
+
+            if (groups_.end() == it) { continue; }
+
+            auto& group = it->second;
+
+            // The task may have been queued before the group was deactivated
+            if (false == group.active_) {
+                group.busy_ = false;
+                state_changed_.notify_all();
+
+                continue;
+            }
+
+            callback = group.callback_;
+            group.worker_ = std::this_thread::get_id();
+        }
+
+        callback(task.second);
+
+        {
+            Lock lock(lock_);
+            auto it = groups_.find(task.first);
+
+            if (groups_.end() != it) {
+                it->second.busy_ = false;
+                it->second.worker_ = std::thread::id{};
+            }
+        }
+
+        state_changed_.notify_all();
+        wake();
+    }
+}
+
+Reactor::~Reactor()
+{
+    {
+        Lock lock(lock_);
+        running_.store(false);
+    }
+
+    wake();
+    task_ready_.notify_all();
+    state_changed_.notify_all();
+
+    if (poller_.joinable()) { poller_.join(); }
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+    zmq_close(wake_push_);
+    zmq_close(wake_pull_);
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,87 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs::network::zeromq::implementation
+{
+// Multiplexes the incoming side of every registered socket on a single
+// zmq_poll thread. Ready sockets are handed to a pool of worker threads and
+// are removed from the poll set until their callback returns, so a zmq socket
+// is never touched by two threads at the same time.
+//
+// Callbacks must not block. Work which may wait on a lock, on another
+// network reply or on Unregister for a different group belongs on another
+// thread. As a safeguard the pool grows by one thread whenever tasks have
+// been waiting while every worker was busy, so callbacks which block anyway
+// degrade performance instead of stalling the process.
+class Reactor
+{
+public:
+    bool Register(
+        const void* owner,
+        const std::vector<void*>& sockets,
+        const zeromq::Context::ReceiveCallback& callback);
+    void Unregister(const void* owner);
+
+    Reactor(void* context, const std::size_t workers);
+
+    ~Reactor();
+
+private:
+    struct Group {
+        std::vector<void*> sockets_{};
+        zeromq::Context::ReceiveCallback callback_{};
+        bool active_{true};
+        bool busy_{false};
+        std::thread::id worker_{};
+    };
+
+    using Task = std::pair<const void*, void*>;
+
+    mutable std::mutex lock_;
+    mutable std::mutex wake_lock_;
+    std::condition_variable state_changed_;
+    std::condition_variable task_ready_;
+    std::atomic<bool> running_{true};
+    std::map<const void*, Group> groups_;
+    std::deque<Task> tasks_;
+    // Number of workers waiting for a task
+    std::size_t idle_{0};
+    std::chrono::steady_clock::time_point last_taken_{};
+    std::uint64_t generation_{0};
+    std::uint64_t poll_generation_{0};
+    void* wake_pull_{nullptr};
+    void* wake_push_{nullptr};
+    std::thread poller_;
+    std::vector<std::thread> workers_;
+
+    void drain_wakeups();
+    void poll();
+    void wake();
+    void work();
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
@@ -8,8 +8,8 @@
 #include "Internal.hpp"
 #include "stdafx.hpp"
 
-#include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/Types.hpp"
@@ -18,12 +18,9 @@
 
 #include "Socket.hpp"
 
-#include <memory>
 #include <mutex>
 #include <thread>
-
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define RECEIVER_POLL_MILLISECONDS 1000
+#include <vector>
 
 #define RECEIVER_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
@@ -33,74 +30,80 @@ template <typename T>
 class Receiver
 {
 protected:
+    const zeromq::Context& receiver_context_;
     std::mutex& receiver_lock_;
     // Not owned by this class
     void* receiver_socket_{nullptr};
-    OTFlag receiver_run_;
-    std::thread receiver_thread_{};
+    bool receiver_registered_{false};
 
     virtual bool have_callback() const { return false; }
 
     virtual void process_incoming(const Lock& lock, T& message) = 0;
-    virtual void thread()
+    // Invoked by the context's reactor when one of the sockets returned by
+    // receiver_sockets() has a message waiting
+    virtual void receive(void* socket)
     {
-        while (receiver_run_.get()) {
-            if (have_callback()) { break; }
+        // The derived class has not finished construction yet. The socket
+        // stays readable, so the reactor will call again.
+        if (false == have_callback()) {
+            std::this_thread::yield();
 
-            Log::Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
+            return;
         }
 
-        zmq_pollitem_t poll[1];
-
-        while (receiver_run_.get()) {
-            poll[0].socket = receiver_socket_;
-            poll[0].events = ZMQ_POLLIN;
-            const auto events = zmq_poll(poll, 1, RECEIVER_POLL_MILLISECONDS);
-
-            if (0 == events) { continue; }
+        Lock lock(receiver_lock_);
+        auto reply = T::Factory();
+        const auto received =
+            Socket::receive_message(lock, receiver_socket_, reply);
 
-            if (-1 == events) {
-                const auto error = zmq_errno();
-                std::cerr << RECEIVER_METHOD << __FUNCTION__
-                          << ": Poll error: " << zmq_strerror(error)
-                          << std::endl;
+        if (false == received) { return; }
 
-                continue;
-            }
+        process_incoming(lock, reply);
+    }
+    virtual std::vector<void*> receiver_sockets() const
+    {
+        return {receiver_socket_};
+    }
 
-            Lock lock(receiver_lock_, std::try_to_lock);
+    void start_receiver()
+    {
+        if (receiver_registered_) { return; }
 
-            if (!lock.owns_lock()) { return; }
+        receiver_registered_ = receiver_context_.RegisterReceiver(
+            this, receiver_sockets(), [this](void* socket) -> void {
+                this->receive(socket);
+            });
 
-            auto reply = T::Factory();
-            const auto received =
-                Socket::receive_message(lock, receiver_socket_, reply);
+        if (false == receiver_registered_) {
+            otErr << RECEIVER_METHOD << __FUNCTION__
+                  << ": Failed to register with reactor" << std::endl;
+        }
+    }
 
-            if (false == received) { return; }
+    void stop_receiver()
+    {
+        if (false == receiver_registered_) { return; }
 
-            process_incoming(lock, reply);
-            lock.unlock();
-        }
+        receiver_context_.UnregisterReceiver(this);
+        receiver_registered_ = false;
     }
 
-    Receiver(std::mutex& lock, void* socket, const bool startThread)
-        : receiver_lock_(lock)
+    Receiver(
+        const zeromq::Context& context,
+        std::mutex& lock,
+        void* socket,
+        const bool startThread)
+        : receiver_context_(context)
+        , receiver_lock_(lock)
         , receiver_socket_(socket)
-        , receiver_run_(Flag::Factory(true))
-        , receiver_thread_()
+        , receiver_registered_(false)
     {
-        if (startThread) {
-            receiver_thread_ = std::thread(&Receiver::thread, this);
-        }
+        if (startThread) { start_receiver(); }
     }
 
     virtual ~Receiver()
     {
-        receiver_run_->Off();
-        Lock lock(receiver_lock_);
-
-        if (receiver_thread_.joinable()) { receiver_thread_.join(); }
-
+        stop_receiver();
         receiver_socket_ = nullptr;
     }
 
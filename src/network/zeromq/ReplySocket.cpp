@@ -37,7 +37,7 @@ ReplySocket::ReplySocket(
     const ReplyCallback& callback)
     : ot_super(context, SocketType::Reply, direction)
     , CurveServer(lock_, socket_)
-    , Receiver(lock_, socket_, true)
+    , Receiver(context, lock_, socket_, true)
     , callback_(callback)
 {
 }
@@ -38,7 +38,7 @@ SubscribeSocket::SubscribeSocket(
     const zeromq::ListenCallback& callback)
     : ot_super(context, SocketType::Subscribe, Socket::Direction::Connect)
     , CurveClient(lock_, socket_)
-    , Receiver(lock_, socket_, true)
+    , Receiver(context, lock_, socket_, true)
     , callback_(callback)
 {
     // subscribe to all messages until filtering is implemented
@@ -20,9 +20,11 @@
 
 #include "ServerSettings.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 
 #define SERVER_WALLET_FILENAME "notaryServer.xml"
 #define SERVER_MASTER_KEY_TIMEOUT_DEFAULT -1
@@ -157,6 +159,26 @@ bool ConfigLoader::load(
             static_cast<std::int32_t>(lValue));
     }
 
+    {
+        const char* szComment = "; worker_threads is the number of threads "
+                                "which process client requests.\n"
+                                "; Requests which only involve the sending "
+                                "Nym run in parallel.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        const std::int64_t defaultValue =
+            std::max(1u, std::thread::hardware_concurrency());
+        config.CheckSet_long(
+            "heartbeat",
+            "worker_threads",
+            defaultValue,
+            lValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::SetWorkerThreads(static_cast<std::int32_t>(lValue));
+    }
+
     // PERMISSIONS
 
     {
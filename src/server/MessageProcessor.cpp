@@ -34,12 +34,17 @@
 #include "opentxs/otx/Request.hpp"
 
 #include "Server.hpp"
+#include "ServerSettings.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <stddef.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #define OTX_ZAP_DOMAIN "opentxs-otx"
 
@@ -70,15 +75,14 @@ MessageProcessor::MessageProcessor(
           [=](const zmq::Message& incoming) -> OTZMQMessage {
               return this->process_backend(incoming);
           }))
-    , backend_socket_(
-          context.ReplySocket(backend_callback_, zmq::Socket::Direction::Bind))
+    , backend_sockets_()
     , internal_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_internal(incoming);
           }))
     , internal_socket_(context.DealerSocket(
           internal_callback_,
-          zmq::Socket::Direction::Connect))
+          zmq::Socket::Direction::Bind))
     , notification_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_notification(incoming);
@@ -92,9 +96,15 @@ MessageProcessor::MessageProcessor(
     , counter_lock_()
     , drop_incoming_(0)
     , drop_outgoing_(0)
+    , active_connections_()
+    , connection_map_lock_()
+    , processing_lock_()
+    , nym_locks_()
+    , cron_lock_()
+    , cron_wakeup_()
+    , cron_changed_(false)
 {
-    auto bound = backend_socket_->Start(internal_endpoint_);
-    bound &= internal_socket_->Start(internal_endpoint_);
+    auto bound = internal_socket_->Start(internal_endpoint_);
     bound &= notification_socket_->Start(
         server_.API().Endpoints().InternalPushNotification());
 
@@ -120,6 +130,8 @@ void MessageProcessor::associate_connection(
 
 void MessageProcessor::cleanup()
 {
+    wake_cron();
+
     if (thread_) {
         thread_->join();
         thread_.reset();
@@ -138,6 +150,8 @@ void MessageProcessor::DropOutgoing(const int count) const
     drop_outgoing_ = count;
 }
 
+// A legacy request may be followed by a frame which states the encoding of
+// the request, and which indicates the client accepts unarmored replies
 proto::ServerRequest MessageProcessor::extract_proto(
     const zmq::Frame& incoming) const
 {
@@ -178,41 +192,115 @@ void MessageProcessor::init(
     otErr << std::endl
           << OT_METHOD << __FUNCTION__ << ": Bound to endpoint "
           << endpoint.str() << std::endl;
+
+    // The internal dealer socket distributes incoming requests among every
+    // connected worker
+    const auto workers = std::max(ServerSettings::GetWorkerThreads(), 1);
+
+    for (auto i = 0; i < workers; ++i) {
+        backend_sockets_.emplace_back(context_.ReplySocket(
+            backend_callback_, zmq::Socket::Direction::Connect));
+        auto& worker = backend_sockets_.back();
+        const auto started = worker->Start(internal_endpoint_);
+
+        OT_ASSERT(started);
+    }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Started " << workers
+          << " worker threads" << std::endl;
+}
+
+bool MessageProcessor::is_nym_local(const MessageType type)
+{
+    // These commands only read or modify the context, nymfile, nymbox and
+    // accounts of the nym sending the request. Everything else may write to
+    // state belonging to other nyms or to the notary itself.
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::checkNym:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+std::mutex& MessageProcessor::nym_lock(const std::string& nymID) const
+{
+    return nym_locks_[std::hash<std::string>{}(nymID) % nym_locks_.size()];
 }
 
 void MessageProcessor::run()
 {
     while (running_) {
-        // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
+        std::int64_t timeout{0};
+
+        {
+            // Anything which changes the schedule after this point wakes the
+            // wait below
+            Lock lock(cron_lock_);
+            cron_changed_ = false;
+        }
+
+        {
+            // timeout is the time left until the next cron item is due. The
+            // schedule is only modified by requests holding the exclusive lock.
+            sLock lock(processing_lock_);
+            timeout = server_.ComputeTimeout();
+        }
 
         if (timeout <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // Cron may modify any account or nym, so it must not run
+            // simultaneously with any request
+            eLock lock(processing_lock_);
             server_.ProcessCron();
+
+            continue;
         }
 
-        Log::Sleep(std::chrono::milliseconds(50));
+        Lock lock(cron_lock_);
+        cron_wakeup_.wait_for(
+            lock, std::chrono::milliseconds(timeout), [this]() -> bool {
+                return cron_changed_ || (false == bool(running_));
+            });
     }
 }
 
 OTZMQMessage MessageProcessor::process_backend(const zmq::Message& incoming)
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
     std::string reply{};
+    bool error{true};
+    auto encoding{LegacyEncoding::ARMORED};
+    const bool rawReply = read_legacy_encoding(incoming, encoding);
 
-    std::string messageString{};
+    // The request is read straight out of the received frame
     if (0 < incoming.Body().size()) {
-        messageString = *incoming.Body().begin();
+        error =
+            process_message(incoming.Body().at(0), encoding, rawReply, reply);
     }
 
-    bool error = process_message(messageString, reply);
-
     if (error) { reply = ""; }
 
     auto output = zmq::Message::ReplyFactory(incoming);
-    output->AddFrame(reply);
+    output->AddFrame(std::move(reply));
+
+    if (rawReply) {
+        const auto replyEncoding{LegacyEncoding::RAW};
+        output->AddFrame(Data::Factory(&replyEncoding, sizeof(replyEncoding)));
+    }
 
     return output;
 }
@@ -246,6 +334,26 @@ bool MessageProcessor::process_command(
     return true;
 }
 
+bool MessageProcessor::process_command(const Message& request, Message& reply)
+{
+    const auto type = Message::Type(request.m_strCommand->Get());
+
+    if (is_nym_local(type)) {
+        sLock shared(processing_lock_);
+        Lock nymLock(nym_lock(request.m_strNymID->Get()));
+
+        return server_.CommandProcessor().ProcessUserCommand(request, reply);
+    }
+
+    eLock exclusive(processing_lock_);
+    const auto output =
+        server_.CommandProcessor().ProcessUserCommand(request, reply);
+    exclusive.unlock();
+    wake_cron();
+
+    return output;
+}
+
 void MessageProcessor::process_frontend(const zmq::Message& incoming)
 {
     Lock lock(counter_lock_);
@@ -255,8 +363,10 @@ void MessageProcessor::process_frontend(const zmq::Message& incoming)
     } else {
         proto::ServerRequest command{};
         bool isProto{false};
+        auto encoding{LegacyEncoding::ARMORED};
+        const bool isLegacy = read_legacy_encoding(incoming, encoding);
 
-        if (1 < incoming.Body().size()) {
+        if ((1 < incoming.Body().size()) && (false == isLegacy)) {
             command = extract_proto(incoming.Body().at(0));
             isProto = proto::Validate(command, SILENT);
         }
@@ -296,15 +406,34 @@ void MessageProcessor::process_internal(const zmq::Message& incoming)
 }
 
 bool MessageProcessor::process_message(
-    const std::string& messageString,
+    const zmq::Frame& incoming,
+    const LegacyEncoding encoding,
+    const bool rawReply,
     std::string& reply)
 {
-    if (messageString.size() < 1) { return true; }
+    if (incoming.size() < 1) { return true; }
 
-    Armored armored;
-    armored.MemSet(messageString.data(), messageString.size());
     String serialized;
-    armored.GetString(serialized);
+
+    if (LegacyEncoding::RAW == encoding) {
+        if (incoming.size() >= (MAX_STRING_LENGTH - 10)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Request is too large."
+                  << std::endl;
+
+            return true;
+        }
+
+        serialized.Set(
+            static_cast<const char*>(incoming.data()),
+            static_cast<std::uint32_t>(incoming.size()));
+    } else {
+        Armored armored;
+        armored.MemSet(
+            static_cast<const char*>(incoming.data()),
+            static_cast<std::uint32_t>(incoming.size()));
+        armored.GetString(serialized);
+    }
+
     auto request{server_.API().Factory().Message()};
 
     if (false == serialized.Exists()) {
@@ -325,8 +454,7 @@ bool MessageProcessor::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const bool processed = process_command(*request, *replymsg);
 
     if (false == processed) {
         otWarn << OT_METHOD << __FUNCTION__
@@ -348,6 +476,12 @@ bool MessageProcessor::process_message(
         return true;
     }
 
+    if (rawReply) {
+        reply.assign(serializedReply.Get(), serializedReply.GetLength());
+
+        return false;
+    }
+
     Armored armoredReply(serializedReply);
 
     if (false == armoredReply.Exists()) {
@@ -388,15 +522,16 @@ void MessageProcessor::process_notification(const zmq::Message& incoming)
     const auto& payload = incoming.Body().at(1);
     auto message = otx::Reply::Factory(
         nym, nymID, server_.GetServerID(), proto::SERVERREPLY_PUSH, true);
-    message->SetPush(proto::TextToProto<proto::OTXPush>(payload));
+    message->SetPush(
+        proto::RawToProto<proto::OTXPush>(payload.data(), payload.size()));
 
     OT_ASSERT(message->Validate());
 
-    const auto reply = proto::ProtoAsData(message->Contract());
+    auto reply = proto::ProtoAsString(message->Contract());
     auto pushNotification = zmq::Message::Factory();
     pushNotification->AddFrame(connection);
     pushNotification->AddFrame();
-    pushNotification->AddFrame(reply);
+    pushNotification->AddFrame(std::move(reply));
     pushNotification->AddFrame();
     frontend_socket_->Send(pushNotification);
     LogOutput(OT_METHOD)(__FUNCTION__)(": Push notification for ")(nymID)(
@@ -421,5 +556,12 @@ void MessageProcessor::Start()
     }
 }
 
+void MessageProcessor::wake_cron()
+{
+    Lock lock(cron_lock_);
+    cron_changed_ = true;
+    cron_wakeup_.notify_all();
+}
+
 MessageProcessor::~MessageProcessor() {}
 }  // namespace opentxs::server
@@ -7,19 +7,24 @@
 
 #include "Internal.hpp"
 
-#include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/network/zeromq/Socket.hpp"
 #include "opentxs/Proto.hpp"
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace opentxs::server
 {
-class MessageProcessor : Lockable
+class MessageProcessor
 {
 public:
     void DropIncoming(const int count) const;
@@ -39,11 +44,11 @@ public:
 private:
     Server& server_;
     const Flag& running_;
-    [[maybe_unused]] const network::zeromq::Context& context_;
+    const network::zeromq::Context& context_;
     OTZMQListenCallback frontend_callback_;
     OTZMQRouterSocket frontend_socket_;
     OTZMQReplyCallback backend_callback_;
-    OTZMQReplySocket backend_socket_;
+    std::vector<OTZMQReplySocket> backend_sockets_;
     OTZMQListenCallback internal_callback_;
     OTZMQDealerSocket internal_socket_;
     OTZMQListenCallback notification_callback_;
@@ -54,8 +59,23 @@ private:
     mutable int drop_incoming_{0};
     mutable int drop_outgoing_{0};
     // nym id, connection identifier
-    std::map<OTIdentifier, OTData> active_connections_;
+    std::unordered_map<OTIdentifier, OTData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    // Held exclusively by cron and by every request which may modify state
+    // belonging to more than one nym. Requests which only touch the state of
+    // the sending nym hold it shared, plus the lock for that nym.
+    mutable std::shared_mutex processing_lock_;
+    // Nyms share a fixed set of locks chosen by hash, so the memory used does
+    // not grow with the number of nyms. Only one is ever held at a time.
+    mutable std::array<std::mutex, 64> nym_locks_;
+    std::mutex cron_lock_;
+    // Wakes the cron thread whenever a request may have added cron items
+    std::condition_variable cron_wakeup_;
+    // Set under cron_lock_ so that a wakeup sent before the cron thread
+    // starts waiting is not lost
+    bool cron_changed_{false};
+
+    static bool is_nym_local(const MessageType type);
 
     proto::ServerRequest extract_proto(
         const network::zeromq::Frame& incoming) const;
@@ -65,12 +85,19 @@ private:
     bool process_command(
         const proto::ServerRequest& request,
         Identifier& nymID);
+    bool process_command(const Message& request, Message& reply);
     void process_frontend(const network::zeromq::Message& incoming);
     void process_internal(const network::zeromq::Message& incoming);
-    bool process_message(const std::string& messageString, std::string& reply);
+    bool process_message(
+        const network::zeromq::Frame& incoming,
+        const LegacyEncoding encoding,
+        const bool rawReply,
+        std::string& reply);
     void process_notification(const network::zeromq::Message& incoming);
+    std::mutex& nym_lock(const std::string& nymID) const;
     OTData query_connection(const Identifier& nymID);
     void run();
+    void wake_cron();
 
     MessageProcessor() = delete;
 };
@@ -80,6 +80,9 @@ Notary::Notary(Server& server, const opentxs::api::server::Manager& manager)
     , manager_(manager)
     , notification_socket_(
           manager_.ZeroMQ().PushSocket(zmq::Socket::Direction::Connect))
+#if OT_CASH
+    , spent_tokens_(manager_.DataFolder())
+#endif  // OT_CASH
 {
     const auto bound = notification_socket_->Start(
         manager_.Endpoints().InternalPushNotification());
@@ -301,7 +304,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderInbox->VerifyAccount(server_.GetServerNym())) {
+            if (false ==
+                senderInbox->VerifyAbbreviated(server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender inbox")
                     .Flush();
@@ -331,7 +335,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderOutbox->VerifyAccount(server_.GetServerNym())) {
+            if (false ==
+                senderOutbox->VerifyAbbreviated(server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender outbox")
                     .Flush();
@@ -844,8 +849,8 @@ void Notary::NotarizeTransfer(
                 bSuccessLoadingInbox &= recipientOutbox->LoadOutbox();
 
                 if (bSuccessLoadingInbox) {
-                    bSuccessLoadingInbox &=
-                        recipientOutbox->VerifyAccount(server_.GetServerNym());
+                    bSuccessLoadingInbox &= recipientOutbox->VerifyAbbreviated(
+                        server_.GetServerNym());
                 }
             }
 
@@ -876,7 +881,7 @@ void Notary::NotarizeTransfer(
 
             if (true == bSuccessLoadingInbox) {
                 bSuccessLoadingInbox =
-                    recipientInbox->VerifyAccount(server_.GetServerNym());
+                    recipientInbox->VerifyAbbreviated(server_.GetServerNym());
             } else {
                 otErr
                     << "Notary::NotarizeTransfer: Error loading 'to' inbox.\n";
@@ -884,7 +889,7 @@ void Notary::NotarizeTransfer(
 
             if (true == bSuccessLoadingOutbox) {
                 bSuccessLoadingOutbox =
-                    theFromOutbox->VerifyAccount(server_.GetServerNym());
+                    theFromOutbox->VerifyAbbreviated(server_.GetServerNym());
             } else {
                 otErr << "Notary::NotarizeTransfer: Error loading 'from' "
                          "outbox.\n";
@@ -1682,14 +1687,24 @@ void Notary::NotarizeWithdrawal(
 
                 // Pull the token(s) out of the purse that was received from the
                 // client.
+                std::vector<Token*> tokens{};
+
                 while ((pToken = thePurse->Pop(server_.GetServerNym())) !=
                        nullptr) {
                     // We are responsible to cleanup pToken
                     // So I grab a copy here for later...
                     theDeque.push_front(pToken);
+                    tokens.push_back(pToken);
+                }
 
+                // Every token is checked, and the account debited, before
+                // anything is signed so that a withdrawal which fails does
+                // not cost the server any signatures
+                for (auto* token : tokens) {
+                    pToken = token;
                     pMint = manager_.GetPrivateMint(
                         INSTRUMENT_DEFINITION_ID, pToken->GetSeries());
+                    Armored denominationKey;
 
                     if (false == bool(pMint)) {
                         otErr << OT_METHOD << __FUNCTION__
@@ -1729,127 +1744,132 @@ void Notary::NotarizeWithdrawal(
                             strInstrumentDefinitionID.Get());
                         bSuccess = false;
                         break;  // Once there's a failure, we ditch the loop.
+                    } else if (
+                        pToken->GetInstrumentDefinitionID() !=
+                        INSTRUMENT_DEFINITION_ID) {
+                        const String str1(pToken->GetInstrumentDefinitionID()),
+                            str2(INSTRUMENT_DEFINITION_ID);
+                        bSuccess = false;
+                        Log::vError(
+                            "%s: ERROR while withdrawing token: "
+                            "Expected instrument definition id "
+                            "%s but found %s "
+                            "instead. (Failure.)\n",
+                            __FUNCTION__,
+                            str2.Get(),
+                            str1.Get());
+                        break;
+                    } else if (false == pMint->GetPublic(
+                                            denominationKey,
+                                            pToken->GetDenomination())) {
+                        bSuccess = false;
+                        Log::vError(
+                            "%s: Mint (series %d) has no key for "
+                            "denomination %" PRId64 ". (Failure.)\n",
+                            __FUNCTION__,
+                            pToken->GetSeries(),
+                            pToken->GetDenomination());
+                        break;
                     } else {
-                        String theStringReturnVal;
+                        // Deduct the amount from the account...
+                        if (theAccount.get().Debit(
+                                pToken->GetDenomination())) {  // todo need
+                                                               // to be able
+                                                               // to "roll
+                                                               // back" if
+                                                               // anything
+                            // inside this
+                            // block
+                            // fails.
+                            bSuccess = true;
+
+                            // Credit the server's cash account for this
+                            // instrument definition in the same
+                            // amount that was debited. When the token is
+                            // deposited again, Debit that same
+                            // server cash account and deposit in the
+                            // depositor's acct.
+                            // Why, you might ask? Because if the token
+                            // expires, the money will stay in
+                            // the bank's cash account instead of being lost
+                            // (and screwing up the overall
+                            // issuer balance, with the issued money
+                            // disappearing forever.) The bank knows
+                            // that once the series expires, whatever funds
+                            // are left in that cash account are
+                            // for the bank to keep. They can be transferred
+                            // to another account and kept, instead
+                            // of being lost.
+                            if (!pMintCashReserveAcct.get().Credit(
+                                    pToken->GetDenomination())) {
+                                otErr << "Error crediting mint cash "
+                                         "reserve account...\n";
+
+                                // Reverse the account debit (even though
+                                // we're not going to save it anyway.)
+                                if (false == theAccount.get().Credit(
+                                                 pToken->GetDenomination()))
+                                    Log::vError(
+                                        "%s: Failed crediting "
+                                        "user account back.\n",
+                                        __FUNCTION__);
 
-                        if (pToken->GetInstrumentDefinitionID() !=
-                            INSTRUMENT_DEFINITION_ID) {
-                            const String str1(
-                                pToken->GetInstrumentDefinitionID()),
-                                str2(INSTRUMENT_DEFINITION_ID);
+                                bSuccess = false;
+                                break;
+                            }
+                        } else {
                             bSuccess = false;
-                            Log::vError(
-                                "%s: ERROR while signing token: "
-                                "Expected instrument definition id "
-                                "%s but found %s "
-                                "instead. (Failure.)\n",
+                            Log::vOutput(
+                                0,
+                                "%s: Unable to debit account "
+                                "%s in the amount of: %" PRId64 "\n",
                                 __FUNCTION__,
-                                str2.Get(),
-                                str1.Get());
-                            break;
+                                strAccountID.Get(),
+                                pToken->GetDenomination());
+                            break;  // Once there's a failure, we ditch the
+                                    // loop.
                         }
-                        // TokenIndex is for cash systems that send multiple
-                        // proto-tokens, so the Mint
-                        // knows which proto-token has been chosen for signing.
-                        // But Lucre only uses a single proto-token, so the
-                        // token index is always 0.
-                        //
-                        else if (!(pMint->SignToken(
-                                     server_.GetServerNym(),
-                                     *pToken,
-                                     theStringReturnVal,
-                                     0)))  // nTokenIndex = 0 //
-                        // ******************************************
-                        {
+                    }
+                }  // For each token popped out of the purse...
+
+                if (bSuccess) {
+                    // Each series signs all of its tokens in one batch, so
+                    // its keys are only decoded once per withdrawal
+                    const auto signatures =
+                        sign_tokens(INSTRUMENT_DEFINITION_ID, tokens);
+
+                    for (auto* token : tokens) {
+                        pToken = token;
+
+                        if (0 == signatures.count(pToken)) {
                             bSuccess = false;
                             Log::vError(
-                                "%s: Failure in call: "
-                                "pMint->SignToken(server_.GetServerNym(), "
-                                "*pToken, theStringReturnVal, 0). "
-                                "(Returning.)\n",
+                                "%s: Failed to sign token. (Returning.)\n",
                                 __FUNCTION__);
                             break;
-                        } else {
-                            Armored theArmorReturnVal(theStringReturnVal);
-
-                            pToken->ReleaseSignatures();  // this releases the
-                                                          // normal signatures,
-                            // not the Lucre signed
-                            // token from the Mint,
-                            // above.
-
-                            pToken->SetSignature(
-                                theArmorReturnVal,
-                                0);  // nTokenIndex = 0
-
-                            // Sign and Save the token
-                            pToken->SignContract(server_.GetServerNym());
-                            pToken->SaveContract();
-
-                            // Now the token is in signedToken mode, and the
-                            // other prototokens have been released.
-
-                            // Deduct the amount from the account...
-                            if (theAccount.get().Debit(
-                                    pToken->GetDenomination())) {  // todo need
-                                                                   // to be able
-                                                                   // to "roll
-                                                                   // back" if
-                                                                   // anything
-                                // inside this
-                                // block
-                                // fails.
-                                bSuccess = true;
-
-                                // Credit the server's cash account for this
-                                // instrument definition in the same
-                                // amount that was debited. When the token is
-                                // deposited again, Debit that same
-                                // server cash account and deposit in the
-                                // depositor's acct.
-                                // Why, you might ask? Because if the token
-                                // expires, the money will stay in
-                                // the bank's cash account instead of being lost
-                                // (and screwing up the overall
-                                // issuer balance, with the issued money
-                                // disappearing forever.) The bank knows
-                                // that once the series expires, whatever funds
-                                // are left in that cash account are
-                                // for the bank to keep. They can be transferred
-                                // to another account and kept, instead
-                                // of being lost.
-                                if (!pMintCashReserveAcct.get().Credit(
-                                        pToken->GetDenomination())) {
-                                    otErr << "Error crediting mint cash "
-                                             "reserve account...\n";
-
-                                    // Reverse the account debit (even though
-                                    // we're not going to save it anyway.)
-                                    if (false == theAccount.get().Credit(
-                                                     pToken->GetDenomination()))
-                                        Log::vError(
-                                            "%s: Failed crediting "
-                                            "user account back.\n",
-                                            __FUNCTION__);
-
-                                    bSuccess = false;
-                                    break;
-                                }
-                            } else {
-                                bSuccess = false;
-                                Log::vOutput(
-                                    0,
-                                    "%s: Unable to debit account "
-                                    "%s in the amount of: %" PRId64 "\n",
-                                    __FUNCTION__,
-                                    strAccountID.Get(),
-                                    pToken->GetDenomination());
-                                break;  // Once there's a failure, we ditch the
-                                        // loop.
-                            }
                         }
+
+                        String theStringReturnVal(signatures.at(pToken));
+                        Armored theArmorReturnVal(theStringReturnVal);
+
+                        pToken->ReleaseSignatures();  // this releases the
+                                                      // normal signatures,
+                                                      // not the Lucre signed
+                                                      // token from the Mint,
+                                                      // above.
+
+                        pToken->SetSignature(
+                            theArmorReturnVal,
+                            0);  // nTokenIndex = 0
+
+                        // Sign and Save the token
+                        pToken->SignContract(server_.GetServerNym());
+                        pToken->SaveContract();
+
+                        // Now the token is in signedToken mode, and the
+                        // other prototokens have been released.
                     }
-                }  // While success popping token out of the purse...
+                }
 
                 if (bSuccess) {
                     while (!theDeque.empty()) {
@@ -7930,8 +7950,8 @@ void Notary::NotarizeProcessInbox(
                     // to, so we can add that record to it.
 
                     if (true == bSuccessLoadingInbox)
-                        bSuccessLoadingInbox =
-                            theFromInbox->VerifyAccount(server_.GetServerNym());
+                        bSuccessLoadingInbox = theFromInbox->VerifyAbbreviated(
+                            server_.GetServerNym());
                     else
                         otErr << "ERROR missing 'from' "
                                  "inbox in "
@@ -7942,8 +7962,9 @@ void Notary::NotarizeProcessInbox(
                     // exist.
 
                     if (true == bSuccessLoadingOutbox)
-                        bSuccessLoadingOutbox = theFromOutbox->VerifyAccount(
-                            server_.GetServerNym());
+                        bSuccessLoadingOutbox =
+                            theFromOutbox->VerifyAbbreviated(
+                                server_.GetServerNym());
                     else  // If it does not already exist, that
                         // is an error condition. For now, log
                         // and fail.
@@ -8359,14 +8380,28 @@ void Notary::process_cash_deposit(
                                          // successful.
 
             bool bSuccess = false;
+            // Tokens are only recorded as spent once the whole purse has
+            // been accepted
+            SpentTokens::Batch spent{};
 
             // Pull the token(s) out of the purse that was received from the
             // client.
+            std::vector<std::unique_ptr<Token>> tokens{};
+
             while (true) {
                 std::unique_ptr<Token> pToken(
                     thePurse->Pop(server_.GetServerNym()));
                 if (!pToken) { break; }
 
+                tokens.emplace_back(std::move(pToken));
+            }
+
+            // Each series verifies all of its tokens in one batch, so its
+            // keys are only decoded once per deposit
+            const auto verified =
+                verify_tokens(NOTARY_ID, INSTRUMENT_DEFINITION_ID, tokens);
+
+            for (auto& pToken : tokens) {
                 pMint = manager_.GetPrivateMint(
                     INSTRUMENT_DEFINITION_ID, pToken->GetSeries());
 
@@ -8378,9 +8413,16 @@ void Notary::process_cash_deposit(
                     (pMintCashReserveAcct = manager_.Wallet().mutable_Account(
                          pMint->AccountID())) &&
                     pMintCashReserveAcct) {
+                    const auto spendable = verified.find(pToken.get());
+                    const bool bToken = (verified.end() != spendable);
                     String strSpendableToken;
-                    bool bToken = pToken->GetSpendableString(
-                        server_.GetServerNym(), strSpendableToken);
+
+                    if (bToken) {
+                        strSpendableToken.Set(spendable->second.first.c_str());
+                    }
+
+                    const auto tokenHash =
+                        SpentTokens::Hash(strSpendableToken);
 
                     if (!bToken)  // if failure getting the spendable token
                                   // data from the token object
@@ -8417,21 +8459,13 @@ void Notary::process_cash_deposit(
                             "server ID. \n");
                         break;
                     }
-                    // This call to VerifyToken verifies the token's Series
-                    // and From/To dates against the
-                    // mint's, and also verifies that the CURRENT date is
-                    // inside that valid date range.
-                    //
-                    // It also verifies the Lucre coin data itself against
-                    // the key for that series and
+                    // verify_tokens above verified the Lucre coin data
+                    // itself against the key for that series and
                     // denomination. (The signed and unblinded Lucre coin is
-                    // finally verified in Lucre
-                    // using the appropriate Mint private key.)
+                    // finally verified in Lucre using the appropriate Mint
+                    // private key.)
                     //
-                    else if (!(pMint->VerifyToken(
-                                 server_.GetServerNym(),
-                                 strSpendableToken,
-                                 pToken->GetDenomination()))) {
+                    else if (false == spendable->second.second) {
                         bSuccess = false;
                         Log::vOutput(
                             0,
@@ -8440,20 +8474,33 @@ void Notary::process_cash_deposit(
                             "verification failed. \n");
                         break;
                     }
+                    // The spent token log of an expired series is pruned, so
+                    // its tokens must be rejected before the spent check
+                    else if (
+                        SpentTokens::Expired(pMint->GetValidTo()) ||
+                        (false == pToken->VerifyCurrentDate())) {
+                        bSuccess = false;
+                        Log::vOutput(
+                            0,
+                            "Notary::NotarizeDeposit: "
+                            "ERROR verifying token: Token "
+                            "has expired. \n");
+                        break;
+                    }
                     // Lookup the token in the SPENT TOKEN DATABASE, and
-                    // make sure
-                    // that it hasn't already been spent...
-                    else if (pToken->IsTokenAlreadySpent(strSpendableToken)) {
+                    // make sure that it hasn't already been spent, or
+                    // included twice in this purse...
+                    else if (
+                        spent_tokens_.IsSpent(
+                            INSTRUMENT_DEFINITION_ID,
+                            pToken->GetSeries(),
+                            pMint->GetValidTo(),
+                            tokenHash) ||
+                        (false == spent[pToken->GetSeries()]
+                                      .hashes_.emplace(tokenHash)
+                                      .second)) {
                         // TODO!!!! Need to store the spent token database
                         // in multiple places, on multiple media!
-                        //          Furthermore need to CHECK those multiple
-                        // places inside IsTokenAlreadySpent.
-                        //          In fact, that should all be configurable
-                        // in the server config file!
-                        //          Related: make sure IsTokenAlreadySpent
-                        // differentiates between ACTUALLY not finding
-                        //          a token as spent (successfully), versus
-                        // some error state with the storage.
                         bSuccess = false;
                         Log::vOutput(
                             0,
@@ -8501,34 +8548,10 @@ void Notary::process_cash_deposit(
                             bSuccess = false;
                             break;
                         }
-                        // Spent token database. This is where the call is
-                        // made to add
-                        // the token to the spent token database.
-                        else if (
-                            false ==
-                            pToken->RecordTokenAsSpent(strSpendableToken)) {
-                            otErr << "Notary::NotarizeDeposit: "
-                                     "Failed recording token as "
-                                     "spent...\n";
-
-                            if (false == pMintCashReserveAcct.get().Credit(
-                                             pToken->GetDenomination()))
-                                otErr << "Notary::NotarizeDeposit: "
-                                         "Failure crediting-back "
-                                         "mint's cash reserve account "
-                                         "while depositing cash.\n";
-
-                            if (false == depositorAccount.get().Debit(
-                                             pToken->GetDenomination()))
-                                otErr << "Notary::NotarizeDeposit: "
-                                         "Failure debiting-back user's "
-                                         "asset account while "
-                                         "depositing cash.\n";
-
-                            bSuccess = false;
-                            break;
-                        } else  // SUCCESS!!! (this iteration)
+                        else  // SUCCESS!!! (this iteration)
                         {
+                            spent[pToken->GetSeries()].valid_to_ =
+                                pMint->GetValidTo();
                             Log::vOutput(
                                 2,
                                 "Notary::NotarizeDeposit: "
@@ -8546,7 +8569,18 @@ void Notary::process_cash_deposit(
                     bSuccess = false;
                     break;
                 }
-            }  // while success popping token from purse
+            }  // for each token popped from the purse
+
+            // Spent token database. This is where the tokens are added to
+            // the spent token database, all at once. Nothing has been saved
+            // yet, so a failure here rolls back the whole deposit.
+            if (bSuccess &&
+                (false ==
+                 spent_tokens_.CheckAndMark(INSTRUMENT_DEFINITION_ID, spent))) {
+                otErr << "Notary::NotarizeDeposit: Failed recording tokens "
+                         "as spent...\n";
+                bSuccess = false;
+            }
 
             if (bSuccess) {
                 depositorAccount.Release();
@@ -8709,4 +8743,97 @@ void Notary::send_push_notification(
     message->AddFrame(proto::ProtoAsString(push));
     notification_socket_->Push(message);
 }
+
+#if OT_CASH
+std::map<const Token*, std::string> Notary::sign_tokens(
+    const Identifier& unitID,
+    const std::vector<Token*>& tokens) const
+{
+    std::map<std::int32_t, std::vector<Token*>> series{};
+    std::map<const Token*, std::string> output{};
+
+    for (auto* token : tokens) {
+        OT_ASSERT(nullptr != token);
+
+        if (token->GetInstrumentDefinitionID() != unitID) { continue; }
+
+        series[token->GetSeries()].push_back(token);
+    }
+
+    for (const auto& [number, batch] : series) {
+        auto mint = manager_.GetPrivateMint(unitID, number);
+
+        if ((false == bool(mint)) || mint->Expired()) { continue; }
+
+        std::vector<std::string> signatures{};
+        // TokenIndex is for cash systems that send multiple proto-tokens, so
+        // the Mint knows which proto-token has been chosen for signing. But
+        // Lucre only uses a single proto-token, so the token index is always 0.
+        mint->SignTokens(server_.GetServerNym(), batch, signatures, 0);
+
+        OT_ASSERT(batch.size() == signatures.size());
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (false == signatures.at(i).empty()) {
+                output.emplace(batch.at(i), signatures.at(i));
+            }
+        }
+    }
+
+    return output;
+}
+
+std::map<const Token*, std::pair<std::string, bool>> Notary::verify_tokens(
+    const Identifier& notaryID,
+    const Identifier& unitID,
+    const std::vector<std::unique_ptr<Token>>& tokens) const
+{
+    std::map<std::int32_t, std::vector<const Token*>> series{};
+    std::map<const Token*, std::pair<std::string, bool>> output{};
+
+    for (const auto& token : tokens) {
+        OT_ASSERT(token);
+
+        String spendable;
+
+        if (false ==
+            token->GetSpendableString(server_.GetServerNym(), spendable)) {
+            continue;
+        }
+
+        output.emplace(token.get(), std::make_pair(spendable.Get(), false));
+
+        if ((token->GetInstrumentDefinitionID() != unitID) ||
+            (token->GetNotaryID() != notaryID)) {
+            continue;
+        }
+
+        series[token->GetSeries()].push_back(token.get());
+    }
+
+    for (const auto& [number, batch] : series) {
+        auto mint = manager_.GetPrivateMint(unitID, number);
+
+        if (false == bool(mint)) { continue; }
+
+        std::vector<std::pair<std::string, std::int64_t>> cleartext{};
+        std::vector<bool> verified{};
+
+        for (const auto* token : batch) {
+            cleartext.emplace_back(
+                output.at(token).first, token->GetDenomination());
+        }
+
+        mint->VerifyTokens(server_.GetServerNym(), cleartext, verified);
+
+        OT_ASSERT(batch.size() == verified.size());
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            output.at(batch.at(i)).second = verified.at(i);
+        }
+    }
+
+    return output;
+}
+#endif  // OT_CASH
 }  // namespace opentxs::server
@@ -7,6 +7,16 @@
 
 #include "Internal.hpp"
 
+#if OT_CASH
+#include "SpentTokens.hpp"
+#endif  // OT_CASH
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace opentxs
 {
 namespace server
@@ -51,6 +61,9 @@ private:
     Server& server_;
     const opentxs::api::server::Manager& manager_;
     OTZMQPushSocket notification_socket_;
+#if OT_CASH
+    SpentTokens spent_tokens_;
+#endif  // OT_CASH
 
     std::unique_ptr<Cheque> extract_cheque(
         const Identifier& serverID,
@@ -61,6 +74,15 @@ private:
         const std::shared_ptr<const Ledger>& inbox,
         const std::shared_ptr<const Ledger>& outbox,
         const std::shared_ptr<const OTTransaction>& item) const;
+#if OT_CASH
+    std::map<const Token*, std::string> sign_tokens(
+        const Identifier& unitID,
+        const std::vector<Token*>& tokens) const;
+    std::map<const Token*, std::pair<std::string, bool>> verify_tokens(
+        const Identifier& notaryID,
+        const Identifier& unitID,
+        const std::vector<std::unique_ptr<Token>>& tokens) const;
+#endif  // OT_CASH
 
     void cancel_cheque(
         const OTTransaction& input,
@@ -50,16 +50,14 @@ ReplyMessage::ReplyMessage(
     message_.m_strNymID = original_.m_strNymID;
     message_.m_strCommand = Message::ReplyCommand(type).c_str();
     message_.m_bSuccess = false;
+    message_.SetAcceptsRanges();
     attach_request();
     init_ = init();
 }
 
-std::set<RequestNumber> ReplyMessage::Acknowledged() const
+const IntervalSet& ReplyMessage::Acknowledged() const
 {
-    std::set<RequestNumber> output{};
-    original_.m_AcknowledgedReplies.Output(output);
-
-    return output;
+    return original_.m_AcknowledgedReplies.Numbers();
 }
 
 void ReplyMessage::attach_request()
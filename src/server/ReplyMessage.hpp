@@ -30,7 +30,7 @@ public:
         const MessageType& type,
         Message& output);
 
-    std::set<RequestNumber> Acknowledged() const;
+    const IntervalSet& Acknowledged() const;
     bool HaveContext() const;
     const bool& Init() const;
     const Message& Original() const;
@@ -21,6 +21,8 @@ std::int64_t ServerSettings::__min_market_scale = 1;
 std::int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
 std::int32_t ServerSettings::__heartbeat_ms_between_beats = 100;
+// The number of threads processing client requests.
+std::int32_t ServerSettings::__worker_threads = 1;
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 std::string ServerSettings::__override_nym_id;
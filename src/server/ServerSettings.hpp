@@ -43,6 +43,13 @@ struct ServerSettings {
         __heartbeat_ms_between_beats = value;
     }
 
+    static std::int32_t GetWorkerThreads() { return __worker_threads; }
+
+    static void SetWorkerThreads(std::int32_t value)
+    {
+        __worker_threads = value;
+    }
+
     static const std::string& GetOverrideNymID() { return __override_nym_id; }
 
     static void SetOverrideNymID(const std::string& id)
@@ -55,6 +62,8 @@ struct ServerSettings {
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
 
+    static std::int32_t __worker_threads;
+
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
     // Are usage credits REQUIRED in order to use this server?
@@ -0,0 +1,426 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "SpentTokens.hpp"
+
+#if OT_CASH
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "util/FileDescriptor.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+#define SPENT_LOG_EXTENSION ".log"
+#define SPENT_PRUNE_INTERVAL (24 * 60 * 60)
+
+#define OT_METHOD "opentxs::server::SpentTokens::"
+
+namespace opentxs::server
+{
+SpentTokens::SpentTokens(const std::string& dataFolder)
+    : data_folder_(dataFolder)
+    , lock_()
+    , series_()
+    , next_prune_(0)
+{
+}
+
+bool SpentTokens::append(
+    const Lock& lock,
+    const std::string& name,
+    Series& series,
+    const std::set<std::string>& hashes)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    std::string data{};
+
+    for (const auto& hash : hashes) { data += hash + "\n"; }
+
+    const auto path = log_path(name);
+    FileDescriptor fd(path, O_WRONLY | O_APPEND | O_CLOEXEC);
+
+    if (!fd) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to open " << path
+              << std::endl;
+
+        return false;
+    }
+
+    if (false == (fd.Write(data) && fd.Sync())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to write " << path
+              << std::endl;
+        // Drop whatever part of the batch did reach the log so that a later
+        // append does not follow a torn record
+        const auto reverted = ::ftruncate(fd, series.size_);
+
+        if (0 != reverted) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to revert " << path
+                  << std::endl;
+            // The next load will discard any torn record
+            series_.erase(name);
+        }
+
+        return false;
+    }
+
+    series.size_ += data.size();
+
+    for (const auto& hash : hashes) { series.hashes_.emplace(hash); }
+
+    return true;
+}
+
+bool SpentTokens::CheckAndMark(const Identifier& unitID, const Batch& batch)
+{
+    Lock lock(lock_);
+    const auto now = OTTimeGetCurrentTime();
+    std::vector<std::pair<std::string, const Tokens*>> pending{};
+
+    for (const auto& [series, tokens] : batch) {
+        const auto key = name(unitID, series);
+
+        if (expired(tokens.valid_to_, now)) {
+            otOut << OT_METHOD << __FUNCTION__ << ": Series has expired: "
+                  << key << std::endl;
+
+            return false;
+        }
+
+        auto* loaded = load(lock, key, tokens.valid_to_);
+
+        if (nullptr == loaded) { return false; }
+
+        if (expired(loaded->valid_to_, now)) {
+            otOut << OT_METHOD << __FUNCTION__ << ": Series has expired: "
+                  << key << std::endl;
+
+            return false;
+        }
+
+        for (const auto& hash : tokens.hashes_) {
+            if (0 < loaded->hashes_.count(hash)) {
+                otOut << OT_METHOD << __FUNCTION__
+                      << ": Token was already spent: " << key << " " << hash
+                      << std::endl;
+
+                return false;
+            }
+        }
+
+        pending.emplace_back(key, &tokens);
+    }
+
+    for (const auto& [key, tokens] : pending) {
+        auto* loaded = load(lock, key, tokens->valid_to_);
+
+        if (nullptr == loaded) { return false; }
+
+        if (false == append(lock, key, *loaded, tokens->hashes_)) {
+            return false;
+        }
+    }
+
+    if (now >= next_prune_) {
+        prune(lock, now);
+        next_prune_ = now + SPENT_PRUNE_INTERVAL;
+    }
+
+    return true;
+}
+
+bool SpentTokens::create(
+    const Lock& lock,
+    const std::string& name,
+    Series& series,
+    const time64_t validTo)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto directory = folder();
+    const auto path = log_path(name);
+    const auto temp = path + ".tmp";
+    const auto legacy = legacy_path(name);
+    boost::system::error_code ec{};
+    boost::filesystem::create_directories(directory, ec);
+    series.valid_to_ = validTo;
+    std::string data = std::to_string(validTo) + "\n";
+
+    if (boost::filesystem::is_directory(legacy, ec)) {
+        for (boost::filesystem::directory_iterator it(legacy, ec), end{};
+             (false == bool(ec)) && (it != end);
+             it.increment(ec)) {
+            if (false == boost::filesystem::is_regular_file(it->status())) {
+                continue;
+            }
+
+            const auto hash = it->path().filename().string();
+
+            if (series.hashes_.emplace(hash).second) { data += hash + "\n"; }
+        }
+
+        if (ec) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to read " << legacy
+                  << std::endl;
+
+            return false;
+        }
+
+        otWarn << OT_METHOD << __FUNCTION__ << ": Imported "
+               << series.hashes_.size() << " spent tokens from " << legacy
+               << std::endl;
+    }
+
+    {
+        FileDescriptor fd(temp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+        if (false == (fd.Write(data) && fd.Sync())) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to write " << temp
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    if (0 != std::rename(temp.c_str(), path.c_str()) ||
+        !FileDescriptor::SyncDirectory(directory)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to create " << path
+              << std::endl;
+
+        return false;
+    }
+
+    series.size_ = data.size();
+    // The legacy files are only removed once the log holding them is durable
+    boost::filesystem::remove_all(legacy, ec);
+
+    return true;
+}
+
+bool SpentTokens::Expired(const time64_t validTo)
+{
+    return expired(validTo, OTTimeGetCurrentTime());
+}
+
+bool SpentTokens::expired(const time64_t validTo, const time64_t now)
+{
+    // A series without an expiration never expires
+    return (OT_TIME_ZERO < validTo) && (validTo < now);
+}
+
+std::string SpentTokens::folder() const
+{
+    return (boost::filesystem::path(data_folder_) / OTFolders::Spent().Get())
+        .string();
+}
+
+std::string SpentTokens::Hash(const String& token)
+{
+    auto id = Identifier::Factory();
+    id->CalculateDigest(token);
+
+    return String::Factory(id)->Get();
+}
+
+bool SpentTokens::IsSpent(
+    const Identifier& unitID,
+    const std::int32_t series,
+    const time64_t validTo,
+    const std::string& hash)
+{
+    Lock lock(lock_);
+    const auto now = OTTimeGetCurrentTime();
+
+    // The log of an expired series may have been pruned, so none of its
+    // tokens can be accepted
+    if (expired(validTo, now)) { return true; }
+
+    const auto* loaded = load(lock, name(unitID, series), validTo);
+
+    // All failures must be treated as a spent token
+    if (nullptr == loaded) { return true; }
+
+    if (expired(loaded->valid_to_, now)) { return true; }
+
+    return 0 < loaded->hashes_.count(hash);
+}
+
+std::string SpentTokens::legacy_path(const std::string& name) const
+{
+    return (boost::filesystem::path(folder()) / name).string();
+}
+
+SpentTokens::Series* SpentTokens::load(
+    const Lock& lock,
+    const std::string& name,
+    const time64_t validTo)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto it = series_.find(name);
+
+    if (series_.end() != it) { return &it->second; }
+
+    Series series{};
+    boost::system::error_code ec{};
+    const bool exists = boost::filesystem::exists(log_path(name), ec);
+
+    if (ec) { return nullptr; }
+
+    if (exists) {
+        if (false == read(lock, name, series)) { return nullptr; }
+
+        // Left behind if the previous import was interrupted
+        boost::filesystem::remove_all(legacy_path(name), ec);
+    } else {
+        if (false == create(lock, name, series, validTo)) { return nullptr; }
+    }
+
+    return &series_.emplace(name, std::move(series)).first->second;
+}
+
+std::string SpentTokens::log_path(const std::string& name) const
+{
+    return legacy_path(name) + SPENT_LOG_EXTENSION;
+}
+
+std::string SpentTokens::name(
+    const Identifier& unitID,
+    const std::int32_t series)
+{
+    return unitID.str() + "." + std::to_string(series);
+}
+
+void SpentTokens::Prune()
+{
+    Lock lock(lock_);
+    const auto now = OTTimeGetCurrentTime();
+    prune(lock, now);
+    next_prune_ = now + SPENT_PRUNE_INTERVAL;
+}
+
+void SpentTokens::prune(const Lock& lock, const time64_t now)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const std::string extension{SPENT_LOG_EXTENSION};
+    std::vector<std::string> expired{};
+    boost::system::error_code ec{};
+
+    for (boost::filesystem::directory_iterator it(folder(), ec), end{};
+         (false == bool(ec)) && (it != end);
+         it.increment(ec)) {
+        const auto& path = it->path();
+
+        if (extension != path.extension().string()) { continue; }
+
+        std::ifstream file(path.string());
+        time64_t validTo{0};
+
+        if (false == bool(file >> validTo)) { continue; }
+
+        if (expired(validTo, now)) {
+            expired.emplace_back(path.stem().string());
+        }
+    }
+
+    for (const auto& name : expired) {
+        otWarn << OT_METHOD << __FUNCTION__ << ": Removing spent tokens for "
+               << "expired series " << name << std::endl;
+        remove(lock, name);
+    }
+}
+
+bool SpentTokens::read(
+    const Lock& lock,
+    const std::string& name,
+    Series& series)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto path = log_path(name);
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    const std::string data{std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>()};
+
+    if (file.bad()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to read " << path
+              << std::endl;
+
+        return false;
+    }
+
+    std::size_t start{0};
+    auto end = data.find('\n');
+
+    if (std::string::npos == end) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid header in " << path
+              << std::endl;
+
+        return false;
+    }
+
+    try {
+        series.valid_to_ = std::stoll(data.substr(0, end));
+    } catch (...) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid header in " << path
+              << std::endl;
+
+        return false;
+    }
+
+    start = end + 1;
+
+    // A record without its newline was interrupted by a crash and never
+    // acknowledged, so it is discarded
+    while (std::string::npos != (end = data.find('\n', start))) {
+        if (end > start) {
+            series.hashes_.emplace(data.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    series.size_ = start;
+
+    if (start < data.size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Discarding "
+              << (data.size() - start) << " bytes from the end of " << path
+              << std::endl;
+
+        if (0 != ::truncate(path.c_str(), series.size_)) { return false; }
+    }
+
+    return true;
+}
+
+void SpentTokens::remove(const Lock& lock, const std::string& name)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    boost::system::error_code ec{};
+    series_.erase(name);
+    boost::filesystem::remove(log_path(name), ec);
+    boost::filesystem::remove_all(legacy_path(name), ec);
+}
+}  // namespace opentxs::server
+#endif  // OT_CASH
@@ -0,0 +1,125 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#if OT_CASH
+#include "opentxs/core/util/Common.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+namespace opentxs
+{
+namespace server
+{
+/** Double spend protection for Lucre tokens.
+ *
+ *  Each mint series has an append-only log in the spent folder. The first
+ *  line of a log holds the time after which tokens from the series are no
+ *  longer valid, and each following line holds the hash of one spent token.
+ *  Logs are read into memory the first time a series is used, so checking a
+ *  token does not touch the disk. A purse is recorded with a single write and
+ *  sync per series, and a log whose series has expired is deleted since none
+ *  of its tokens can be deposited anymore.
+ *
+ *  The per-token files written by earlier versions are imported into the log
+ *  when a series is first opened, and then removed.
+ */
+class SpentTokens
+{
+public:
+    struct Tokens {
+        time64_t valid_to_{0};
+        std::set<std::string> hashes_{};
+    };
+
+    /** Tokens to be recorded, indexed by series */
+    using Batch = std::map<std::int32_t, Tokens>;
+
+    /** Returns true if tokens from a series with this valid-to time can no
+     *  longer be deposited */
+    static bool Expired(const time64_t validTo);
+    /** Calculates the value recorded for a spendable token */
+    static std::string Hash(const String& token);
+
+    /** Records every token in the batch as spent, unless any of them has
+     *  already been spent
+     *
+     *  Returns false if nothing was recorded, or if recording failed part
+     *  way through a batch containing more than one series. A batch which
+     *  contains an expired series is always rejected, since the log for that
+     *  series may already have been pruned.
+     */
+    bool CheckAndMark(const Identifier& unitID, const Batch& batch);
+    /** Returns true if the token has been spent, if its series has expired,
+     *  or if this can not be determined */
+    bool IsSpent(
+        const Identifier& unitID,
+        const std::int32_t series,
+        const time64_t validTo,
+        const std::string& hash);
+    /** Deletes the logs of every expired series */
+    void Prune();
+
+    explicit SpentTokens(const std::string& dataFolder);
+
+    ~SpentTokens() = default;
+
+private:
+    struct Series {
+        time64_t valid_to_{0};
+        // Length of the log up to the end of the last complete record
+        std::int64_t size_{0};
+        std::unordered_set<std::string> hashes_{};
+    };
+
+    const std::string data_folder_;
+    std::mutex lock_;
+    std::map<std::string, Series> series_;
+    time64_t next_prune_{0};
+
+    static bool expired(const time64_t validTo, const time64_t now);
+    static std::string name(
+        const Identifier& unitID,
+        const std::int32_t series);
+
+    bool append(
+        const Lock& lock,
+        const std::string& name,
+        Series& series,
+        const std::set<std::string>& hashes);
+    bool create(
+        const Lock& lock,
+        const std::string& name,
+        Series& series,
+        const time64_t validTo);
+    std::string folder() const;
+    std::string legacy_path(const std::string& name) const;
+    Series* load(
+        const Lock& lock,
+        const std::string& name,
+        const time64_t validTo);
+    std::string log_path(const std::string& name) const;
+    void prune(const Lock& lock, const time64_t now);
+    bool read(const Lock& lock, const std::string& name, Series& series);
+    void remove(const Lock& lock, const std::string& name);
+
+    SpentTokens() = delete;
+    SpentTokens(const SpentTokens&) = delete;
+    SpentTokens(SpentTokens&&) = delete;
+    SpentTokens& operator=(const SpentTokens&) = delete;
+    SpentTokens& operator=(SpentTokens&&) = delete;
+};
+}  // namespace server
+}  // namespace opentxs
+#endif  // OT_CASH
@@ -267,7 +267,7 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
     // The server reads the list of acknowledged replies from the incoming
     // client message... If we add any acknowledged replies to the server-side
     // list, we will want to save (at the end.)
-    auto numlist_ack_reply = reply.Acknowledged();
+    const auto& numlist_ack_reply = reply.Acknowledged();
     const auto nymID = Identifier::Factory(context.RemoteNym().ID());
     auto nymbox{manager_.Factory().Ledger(nymID, nymID, context.Server())};
 
@@ -277,7 +277,7 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
         nymbox->VerifySignature(server_.GetServerNym())) {
         bool bIsDirtyNymbox = false;
 
-        for (auto& it : numlist_ack_reply) {
+        for (const auto& it : numlist_ack_reply) {
             const std::int64_t lRequestNum = it;
             // If the # already appears on its internal list, then it does
             // nothing. (It must have already done
@@ -1830,7 +1830,7 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
     // ...or generate them otherwise...
 
     if (inboxLoaded) {
-        inboxLoaded = inbox->VerifyAccount(serverNym);
+        inboxLoaded = inbox->VerifyAbbreviated(serverNym);
     } else {
         inboxLoaded = inbox->CreateLedger(
             nymID, accountID, serverID, ledgerType::inbox, true);
@@ -1846,7 +1846,7 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
     }
 
     if (true == outboxLoaded) {
-        outboxLoaded = outbox->VerifyAccount(serverNym);
+        outboxLoaded = outbox->VerifyAbbreviated(serverNym);
     } else {
         outboxLoaded = outbox->CreateLedger(
             nymID, accountID, serverID, ledgerType::outbox, true);
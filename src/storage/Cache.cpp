@@ -0,0 +1,87 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include "Cache.hpp"
+
+namespace opentxs::storage
+{
+Cache::Cache(const std::size_t limit)
+    : shard_limit_(limit / STORAGE_CACHE_SHARDS)
+    , shards_()
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+{
+}
+
+Cache::Object Cache::Get(const std::string& hash, const std::type_info& type)
+    const
+{
+    if (0 == shard_limit_) { return {}; }
+
+    auto& shard = this->shard(hash);
+    Lock lock(shard.lock_);
+    auto it = shard.items_.find(Key{hash, std::type_index(type)});
+
+    if (shard.items_.end() == it) {
+        lock.unlock();
+        ++misses_;
+
+        return {};
+    }
+
+    auto& entry = it->second;
+    shard.order_.splice(shard.order_.begin(), shard.order_, entry.position_);
+    auto output = entry.object_;
+    lock.unlock();
+    ++hits_;
+
+    return output;
+}
+
+void Cache::Put(
+    const std::string& hash,
+    const std::type_info& type,
+    const Object& object,
+    const std::size_t size) const
+{
+    if ((false == bool(object)) || (size > shard_limit_)) { return; }
+
+    auto& shard = this->shard(hash);
+    Key key{hash, std::type_index(type)};
+    Lock lock(shard.lock_);
+
+    if (0 < shard.items_.count(key)) { return; }
+
+    while ((shard.size_ + size) > shard_limit_) {
+        OT_ASSERT(false == shard.order_.empty());
+
+        auto it = shard.items_.find(shard.order_.back());
+
+        OT_ASSERT(shard.items_.end() != it);
+
+        shard.size_ -= it->second.size_;
+        shard.items_.erase(it);
+        shard.order_.pop_back();
+        ++evictions_;
+    }
+
+    shard.order_.push_front(key);
+    auto& entry = shard.items_[key];
+    entry.object_ = object;
+    entry.size_ = size;
+    entry.position_ = shard.order_.begin();
+    shard.size_ += size;
+}
+
+Cache::Shard& Cache::shard(const std::string& hash) const
+{
+    return shards_[std::hash<std::string>()(hash) % STORAGE_CACHE_SHARDS];
+}
+}  // namespace opentxs::storage
@@ -0,0 +1,87 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#define STORAGE_CACHE_SHARDS 16
+
+namespace opentxs::storage
+{
+// Memory bounded cache of validated, parsed objects keyed by content hash.
+// Each shard keeps its own lock and least recently used list so concurrent
+// readers of unrelated hashes do not contend.
+class Cache
+{
+public:
+    using Object = std::shared_ptr<const void>;
+
+    std::uint64_t Evictions() const { return evictions_.load(); }
+    Object Get(const std::string& hash, const std::type_info& type) const;
+    std::uint64_t Hits() const { return hits_.load(); }
+    std::uint64_t Misses() const { return misses_.load(); }
+    void Put(
+        const std::string& hash,
+        const std::type_info& type,
+        const Object& object,
+        const std::size_t size) const;
+
+    explicit Cache(const std::size_t limit);
+
+    ~Cache() = default;
+
+private:
+    using Key = std::pair<std::string, std::type_index>;
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const
+        {
+            return std::hash<std::string>()(key.first) ^
+                   key.second.hash_code();
+        }
+    };
+
+    struct Entry {
+        Object object_{};
+        std::size_t size_{0};
+        std::list<Key>::iterator position_{};
+    };
+
+    struct Shard {
+        std::mutex lock_{};
+        // Most recently used keys are at the front
+        std::list<Key> order_{};
+        std::unordered_map<Key, Entry, KeyHash> items_{};
+        std::size_t size_{0};
+    };
+
+    const std::size_t shard_limit_{0};
+    mutable std::array<Shard, STORAGE_CACHE_SHARDS> shards_;
+    mutable std::atomic<std::uint64_t> hits_{0};
+    mutable std::atomic<std::uint64_t> misses_{0};
+    mutable std::atomic<std::uint64_t> evictions_{0};
+
+    Shard& shard(const std::string& hash) const;
+
+    Cache() = delete;
+    Cache(const Cache&) = delete;
+    Cache(Cache&&) = delete;
+    Cache& operator=(const Cache&) = delete;
+    Cache& operator=(Cache&&) = delete;
+};
+}  // namespace opentxs::storage
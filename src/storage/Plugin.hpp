@@ -14,7 +14,9 @@
 #include "opentxs/Types.hpp"
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <typeinfo>
 
 namespace opentxs
 {
@@ -103,6 +105,17 @@ bool opentxs::api::storage::Driver::LoadProto(
     std::shared_ptr<T>& serialized,
     const bool checking) const
 {
+    // Keys are content hashes, so a cached object never goes stale. Callers
+    // are free to modify what they receive, so hand out a private copy.
+    const auto existing = std::static_pointer_cast<const T>(
+        cached(hash, typeid(T)));
+
+    if (existing) {
+        serialized.reset(new T(*existing));
+
+        return true;
+    }
+
     std::string raw;
     const bool loaded = Load(hash, checking, raw);
     bool valid = false;
@@ -113,6 +126,14 @@ bool opentxs::api::storage::Driver::LoadProto(
         valid = proto::Validate<T>(*serialized, VERBOSE);
     }
 
+    if (valid) {
+        cache(
+            hash,
+            typeid(T),
+            std::make_shared<const T>(*serialized),
+            sizeof(T) + raw.size());
+    }
+
     if (!valid) {
         if (loaded) {
             otErr << "Specified object was located but could not be "
@@ -34,7 +34,18 @@ public:
     bool auto_publish_units_ = true;
     std::int64_t gc_interval_ =
         C::duration_cast<C::seconds>(C::hours(1)).count();
+    // Number of threads copying objects during garbage collection
+    std::int64_t gc_threads_{4};
+    // Upper bound on objects copied per second during garbage collection.
+    // Zero removes the limit.
+    std::int64_t gc_rate_{0};
     std::string path_{};
+    // Writes arriving within this many milliseconds of each other share a
+    // single root commit. Zero commits every write immediately.
+    std::int64_t commit_window_{0};
+    // Upper bound in bytes for the parsed object cache in front of the
+    // storage drivers. Zero disables the cache.
+    std::int64_t cache_size_{64 * 1024 * 1024};
     InsertCB dht_callback_{};
 
 #if OT_STORAGE_SQLITE
@@ -51,6 +62,16 @@ public:
     std::string fs_root_file_ = "root";
     std::string fs_backup_directory_{""};
     std::string fs_encrypted_backup_directory_{""};
+    // Objects are spread over fs_shard_levels_ nested directories, each
+    // named by fs_shard_width_ characters of the key. Zero levels selects
+    // the flat layout.
+    std::int64_t fs_shard_levels_{2};
+    std::int64_t fs_shard_width_{1};
+    // 0: objects are not synced, 1: file contents are synced, 2: file
+    // contents and directory entries are synced. Objects are synced together
+    // just before the next root is written, and the root file is always
+    // fully synced.
+    std::int64_t fs_durability_{2};
 #endif
 
 #ifdef OT_STORAGE_SQLITE
@@ -12,19 +12,24 @@
 
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
 #include <cstdio>
-#include <fstream>
-#include <ios>
 #include <iostream>
-#include <thread>
+#include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 extern "C" {
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 }
 
 #define PATH_SEPERATOR "/"
+#define FS_MAX_PENDING_SYNC 256
 
 #define OT_METHOD "opentxs::StorageFS::"
 
@@ -42,15 +47,52 @@ StorageFS::StorageFS(
     , folder_(folder)
     , path_seperator_(PATH_SEPERATOR)
     , ready_(Flag::Factory(false))
+    , durability_(static_cast<Durability>(std::min<std::int64_t>(
+          std::max<std::int64_t>(config.fs_durability_, 0),
+          static_cast<std::int64_t>(Durability::Full))))
+    , flush_lock_()
+    , pending_lock_()
+    , pending_()
 {
     Init_StorageFS();
 }
 
 void StorageFS::Cleanup() { Cleanup_StorageFS(); }
 
-void StorageFS::Cleanup_StorageFS()
+void StorageFS::Cleanup_StorageFS() { flush(); }
+
+void StorageFS::flush() const
 {
-    // future cleanup actions go here
+    // Held for the whole flush, so a root written after this returns can not
+    // overtake objects which another thread is still syncing
+    Lock flushLock(flush_lock_);
+    Lock lock(pending_lock_);
+    std::vector<Pending> pending{};
+    pending.swap(pending_);
+    lock.unlock();
+
+    if (pending.empty()) { return; }
+
+    std::set<std::string> directories{};
+
+    for (const auto& item : pending) {
+        if (false == item.file_->Sync()) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to sync file "
+                  << item.filename_ << std::endl;
+        }
+
+        directories.emplace(item.directory_);
+    }
+
+    if (Durability::Full == durability_) {
+        for (const auto& directory : directories) {
+            if (false == sync(directory)) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Failed to sync directory " << directory
+                      << std::endl;
+            }
+        }
+    }
 }
 
 void StorageFS::Init_StorageFS()
@@ -64,14 +106,20 @@ bool StorageFS::LoadFromBucket(
     const bool bucket) const
 {
     value.clear();
+
+    if (false == ready_.get() || folder_.empty()) { return false; }
+
     std::string directory{};
     const auto filename = calculate_path(key, bucket, directory);
-    boost::system::error_code ec{};
 
-    if (false == boost::filesystem::exists(filename, ec)) { return false; }
+    // A failed open is the existence check, so a hit costs a single open,
+    // fstat and read
+    if (false == read_file(filename, value)) {
+        const auto legacy = legacy_path(key, bucket);
 
-    if (ready_.get() && false == folder_.empty()) {
-        value = read_file(filename);
+        if ((legacy != filename) && read_file(legacy, value)) {
+            migrate_legacy(legacy, directory, filename);
+        }
     }
 
     return false == value.empty();
@@ -79,47 +127,141 @@ bool StorageFS::LoadFromBucket(
 
 std::string StorageFS::LoadRoot() const
 {
+    std::string output{};
+
     if (ready_.get() && false == folder_.empty()) {
+        read_file(root_filename(), output);
+    }
+
+    return output;
+}
+
+void StorageFS::migrate_legacy(
+    const std::string& from,
+    const std::string& directory,
+    const std::string& to) const
+{
+    if (false == prepare_directory(directory)) { return; }
+
+    boost::system::error_code ec{};
+    boost::filesystem::rename(from, to, ec);
+
+    if (ec) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to move " << from
+              << " to " << to << std::endl;
 
-        return read_file(root_filename());
+        return;
     }
 
-    return "";
+    if (false == sync(directory)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to sync directory "
+              << directory << std::endl;
+    }
+
+    const auto parent = boost::filesystem::path(from).parent_path().string();
+
+    if (false == sync(parent)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to sync directory "
+              << parent << std::endl;
+    }
 }
 
-std::string StorageFS::prepare_read(const std::string& input) const
+bool StorageFS::prepare_directory(const std::string& directory) const
 {
-    return input;
+    boost::system::error_code ec{};
+
+    if (boost::filesystem::is_directory(directory, ec)) { return true; }
+
+    boost::filesystem::create_directories(directory, ec);
+
+    if (ec) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to create directory "
+              << directory << std::endl;
+
+        return false;
+    }
+
+    // Newly created shard directories must be durable before any object
+    // inside them is reported as stored
+    boost::filesystem::path path(directory);
+
+    while (path.has_parent_path() && (path.string().size() > folder_.size())) {
+        path = path.parent_path();
+
+        if (false == sync(path.string())) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to sync directory " << path.string()
+                  << std::endl;
+        }
+    }
+
+    return true;
 }
 
+void StorageFS::prepare_read(std::string&) const {}
+
 std::string StorageFS::prepare_write(const std::string& input) const
 {
     return input;
 }
 
-std::string StorageFS::read_file(const std::string& filename) const
+bool StorageFS::read_file(const std::string& filename, std::string& output)
+    const
 {
-    boost::system::error_code ec{};
+    output.clear();
+    FileDescriptor fd(filename, O_RDONLY | O_CLOEXEC);
+
+    if (!fd) { return false; }
+
+    struct stat info;
 
-    if (false == boost::filesystem::exists(filename, ec)) { return {}; }
+    if (0 != ::fstat(fd, &info)) { return false; }
 
-    std::ifstream file(
-        filename, std::ios::in | std::ios::ate | std::ios::binary);
+    if ((0 >= info.st_size) || (0xFFFFFFFF <= info.st_size)) { return false; }
 
-    if (file.good()) {
-        std::ifstream::pos_type pos = file.tellg();
+    const auto size = static_cast<std::size_t>(info.st_size);
+    std::size_t position{0};
 
-        if ((0 >= pos) || (0xFFFFFFFF <= pos)) { return {}; }
+    // Objects are small, so reading straight into the output string is
+    // cheaper than setting up and tearing down a mapping for each one
+    output.resize(size);
 
-        std::uint32_t size(pos);
-        file.seekg(0, std::ios::beg);
-        std::vector<char> bytes(size);
-        file.read(&bytes[0], size);
+    while (position < size) {
+        const auto bytes =
+            ::pread(fd, &output[position], size - position, position);
 
-        return prepare_read(std::string(&bytes[0], size));
+        if (0 < bytes) {
+            position += static_cast<std::size_t>(bytes);
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            break;
+        }
     }
 
-    return {};
+    if (position != size) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to read " << filename
+              << std::endl;
+        output.clear();
+
+        return false;
+    }
+
+    prepare_read(output);
+
+    return false == output.empty();
+}
+
+void StorageFS::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket,
+    std::promise<bool>& promise) const
+{
+    // store() does not wait for the disk, so there is no need for the thread
+    // Plugin would start here
+    store(isTransaction, key, value, bucket, &promise);
 }
 
 void StorageFS::store(
@@ -131,78 +273,102 @@ void StorageFS::store(
 {
     OT_ASSERT(nullptr != promise);
 
-    if (ready_.get() && false == folder_.empty()) {
-        std::string directory{};
-        const auto filename = calculate_path(key, bucket, directory);
-        promise->set_value(write_file(directory, filename, value));
-    } else {
+    if ((false == ready_.get()) || folder_.empty()) {
         promise->set_value(false);
+
+        return;
     }
-}
 
-bool StorageFS::StoreRoot(const bool, const std::string& hash) const
-{
-    if (ready_.get() && false == folder_.empty()) {
+    Pending write{};
+    write.filename_ = calculate_path(key, bucket, write.directory_);
 
-        return write_file(folder_, root_filename(), hash);
+    if (write.filename_.empty()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to write empty filename." << std::endl;
+        promise->set_value(false);
+
+        return;
     }
 
-    return false;
-}
+    if (false == prepare_directory(write.directory_)) {
+        promise->set_value(false);
 
-bool StorageFS::sync(const std::string& path) const
-{
-    class FileDescriptor
-    {
-    public:
-        FileDescriptor(const std::string& path)
-            : fd_(::open(path.c_str(), O_DIRECTORY | O_RDONLY))
-        {
-        }
+        return;
+    }
 
-        operator bool() const { return good(); }
-        operator int() const { return fd_; }
+    write.file_.reset(new FileDescriptor(
+        write.filename_, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666));
 
-        ~FileDescriptor()
-        {
-            if (good()) { ::close(fd_); }
-        }
+    OT_ASSERT(write.file_);
 
-    private:
-        int fd_{-1};
+    if (false == write.file_->Write(prepare_write(value))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to write file "
+              << write.filename_ << std::endl;
+        promise->set_value(false);
 
-        bool good() const { return (-1 != fd_); }
+        return;
+    }
 
-        FileDescriptor() = delete;
-        FileDescriptor(const FileDescriptor&) = delete;
-        FileDescriptor(FileDescriptor&&) = delete;
-        FileDescriptor& operator=(const FileDescriptor&) = delete;
-        FileDescriptor& operator=(FileDescriptor&&) = delete;
-    };
+    if (Durability::None == durability_) {
+        promise->set_value(true);
 
-    FileDescriptor fd(path);
+        return;
+    }
 
-    if (!fd) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to open " << path
-              << std::endl;
+    // Objects are only reachable once a root which refers to them has been
+    // stored, so syncing is deferred to StoreRoot and every object written
+    // since the last root shares one barrier
+    Lock lock(pending_lock_);
+    pending_.emplace_back(std::move(write));
+    const bool full = (FS_MAX_PENDING_SYNC <= pending_.size());
+    lock.unlock();
+    promise->set_value(true);
+
+    // Bounds the number of open descriptors between roots
+    if (full) { flush(); }
+}
 
-        return false;
+std::string StorageFS::shard_directory(
+    const std::string& base,
+    const std::string& key) const
+{
+    const auto levels = static_cast<std::size_t>(
+        std::max(config_.fs_shard_levels_, std::int64_t{0}));
+    const auto width = static_cast<std::size_t>(
+        std::max(config_.fs_shard_width_, std::int64_t{1}));
+    auto output{base};
+
+    if (key.size() <= (levels * width)) { return output; }
+
+    // The leading digits of a base58 encoded hash are not uniformly
+    // distributed, so the directory names are taken from the end of the key
+    for (std::size_t i = 1; i <= levels; ++i) {
+        output += path_seperator_;
+        output += key.substr(key.size() - (i * width), width);
+    }
+
+    return output;
+}
+
+bool StorageFS::StoreRoot(const bool, const std::string& hash) const
+{
+    if (ready_.get() && false == folder_.empty()) {
+        flush();
+
+        return write_file(folder_, root_filename(), hash);
     }
 
-    return sync(fd);
+    return false;
 }
 
-bool StorageFS::sync(File& file) const { return sync(file->handle()); }
+bool StorageFS::sync(const std::string& path) const
+{
+    return FileDescriptor::SyncDirectory(path);
+}
 
-bool StorageFS::sync(int fd) const
+bool StorageFS::sync(File& file) const
 {
-#if defined(__APPLE__)
-    // This is a Mac OS X system which does not implement
-    // fsync as such.
-    return 0 == ::fcntl(fd, F_FULLFSYNC);
-#else
-    return 0 == ::fsync(fd);
-#endif
+    return FileDescriptor::Sync(file->handle());
 }
 
 bool StorageFS::write_file(
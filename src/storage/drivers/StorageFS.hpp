@@ -11,11 +11,15 @@
 #include "opentxs/core/Flag.hpp"
 
 #include "storage/Plugin.hpp"
+#include "util/FileDescriptor.hpp"
 
 #include <boost/iostreams/device/file_descriptor.hpp>
 #include <boost/iostreams/stream.hpp>
 
-#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace opentxs
 {
@@ -34,6 +38,13 @@ public:
         std::string& value,
         const bool bucket) const override;
     std::string LoadRoot() const override;
+    using ot_super::Store;
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const override;
     bool StoreRoot(const bool commit, const std::string& hash) const override;
 
     void Cleanup() override;
@@ -45,6 +56,10 @@ protected:
     const std::string path_seperator_{};
     OTFlag ready_;
 
+    void flush() const;
+    std::string shard_directory(
+        const std::string& base,
+        const std::string& key) const;
     bool sync(const std::string& path) const;
 
     StorageFS(
@@ -59,13 +74,42 @@ private:
     typedef boost::iostreams::stream<boost::iostreams::file_descriptor_sink>
         File;
 
+    // How much of each object is flushed to disk before the next root is
+    // written
+    enum class Durability : std::int64_t {
+        None = 0,
+        // File contents are synced, but a new directory entry may be lost
+        File = 1,
+        // File contents and the containing directory are synced
+        Full = 2,
+    };
+
+    // An object which has been written but not yet synced
+    struct Pending {
+        std::string directory_{};
+        std::string filename_{};
+        std::unique_ptr<FileDescriptor> file_{nullptr};
+    };
+
+    const Durability durability_;
+    mutable std::mutex flush_lock_;
+    mutable std::mutex pending_lock_;
+    mutable std::vector<Pending> pending_;
+
     virtual std::string calculate_path(
         const std::string& key,
         const bool bucket,
         std::string& directory) const = 0;
-    virtual std::string prepare_read(const std::string& input) const;
+    virtual std::string legacy_path(const std::string& key, const bool bucket)
+        const = 0;
+    void migrate_legacy(
+        const std::string& from,
+        const std::string& directory,
+        const std::string& to) const;
+    bool prepare_directory(const std::string& directory) const;
+    virtual void prepare_read(std::string& data) const;
     virtual std::string prepare_write(const std::string& input) const;
-    std::string read_file(const std::string& filename) const;
+    bool read_file(const std::string& filename, std::string& output) const;
     virtual std::string root_filename() const = 0;
     void store(
         const bool isTransaction,
@@ -74,7 +118,6 @@ private:
         const bool bucket,
         std::promise<bool>* promise) const override;
     bool sync(File& file) const;
-    bool sync(int fd) const;
     bool write_file(
         const std::string& directory,
         const std::string& filename,
@@ -87,35 +87,7 @@ std::string StorageFSArchive::calculate_path(
     const bool,
     std::string& directory) const
 {
-    directory = folder_;
-    auto& level1 = folder_;
-    std::string level2{};
-
-    if (4 < key.size()) {
-        directory += path_seperator_;
-        directory += key.substr(0, 4);
-        level2 = directory;
-    }
-
-    if (8 < key.size()) {
-        directory += path_seperator_;
-        directory += key.substr(4, 4);
-    }
-
-    boost::system::error_code ec{};
-    boost::filesystem::create_directories(directory, ec);
-
-    if (8 < key.size()) {
-        if (false == sync(level2)) {
-            otErr << OT_METHOD << __FUNCTION__ << ": Unable to sync directory"
-                  << level2 << std::endl;
-        }
-    }
-
-    if (false == sync(level1)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to sync directory"
-              << level1 << std::endl;
-    }
+    directory = shard_directory(folder_, key);
 
     return {directory + path_seperator_ + key};
 }
@@ -142,23 +114,40 @@ void StorageFSArchive::Init_StorageFSArchive()
     if (boost::filesystem::create_directory(folder_, ec)) { ready_->On(); }
 }
 
-std::string StorageFSArchive::prepare_read(const std::string& input) const
+std::string StorageFSArchive::legacy_path(const std::string& key, const bool)
+    const
 {
-    if (false == encrypted_) { return input; }
+    auto directory{folder_};
 
-    const auto ciphertext = proto::TextToProto<proto::Ciphertext>(input);
+    if (4 < key.size()) {
+        directory += path_seperator_;
+        directory += key.substr(0, 4);
+    }
+
+    if (8 < key.size()) {
+        directory += path_seperator_;
+        directory += key.substr(4, 4);
+    }
+
+    return {directory + path_seperator_ + key};
+}
+
+void StorageFSArchive::prepare_read(std::string& data) const
+{
+    if (false == encrypted_) { return; }
+
+    const auto ciphertext = proto::TextToProto<proto::Ciphertext>(data);
 
     OT_ASSERT(encryption_key_);
 
-    std::string output{};
+    data.clear();
     OTPasswordData reason("");
 
-    if (false == encryption_key_.Decrypt(ciphertext, reason, output)) {
+    if (false == encryption_key_.Decrypt(ciphertext, reason, data)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to decrypt value."
               << std::endl;
+        data.clear();
     }
-
-    return output;
 }
 
 std::string StorageFSArchive::prepare_write(const std::string& plaintext) const
@@ -31,7 +31,9 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const override;
-    std::string prepare_read(const std::string& ciphertext) const override;
+    std::string legacy_path(const std::string& key, const bool bucket)
+        const override;
+    void prepare_read(std::string& data) const override;
     std::string prepare_write(const std::string& plaintext) const override;
     std::string root_filename() const override;
 
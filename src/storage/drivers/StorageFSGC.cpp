@@ -55,7 +55,8 @@ std::string StorageFSGC::calculate_path(
     const bool bucket,
     std::string& directory) const
 {
-    directory = folder_ + path_seperator_ + bucket_name(bucket);
+    directory =
+        shard_directory(folder_ + path_seperator_ + bucket_name(bucket), key);
 
     return directory + path_seperator_ + key;
 }
@@ -75,8 +76,11 @@ bool StorageFSGC::EmptyBucket(const bool bucket) const
 {
     assert(random_);
 
-    std::string oldDirectory{};
-    calculate_path("", bucket, oldDirectory);
+    // Objects migrated out of this bucket must be durable before the bucket
+    // is deleted
+    flush();
+    const auto oldDirectory =
+        folder_ + path_seperator_ + bucket_name(bucket);
     std::string random = random_();
     std::string newName = folder_ + path_seperator_ + random;
 
@@ -99,6 +103,13 @@ void StorageFSGC::Init_StorageFSGC()
     ready_->On();
 }
 
+std::string StorageFSGC::legacy_path(const std::string& key, const bool bucket)
+    const
+{
+    return folder_ + path_seperator_ + bucket_name(bucket) + path_seperator_ +
+           key;
+}
+
 void StorageFSGC::purge(const std::string& path) const
 {
     if (path.empty()) { return; }
@@ -30,6 +30,8 @@ private:
         const std::string& key,
         const bool bucket,
         std::string& directory) const override;
+    std::string legacy_path(const std::string& key, const bool bucket)
+        const override;
     void purge(const std::string& path) const;
     std::string root_filename() const override;
 
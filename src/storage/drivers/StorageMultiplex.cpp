@@ -16,10 +16,12 @@
 #include "opentxs/crypto/key/Symmetric.hpp"
 #include "opentxs/Types.hpp"
 
+#include "storage/tree/Migration.hpp"
 #include "storage/tree/Root.hpp"
 #include "storage/tree/Tree.hpp"
 #include "storage/StorageConfig.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -71,6 +73,8 @@ StorageMultiplex::StorageMultiplex(
     , digest_(hash)
     , random_(random)
     , null_(crypto::key::Symmetric::Factory())
+    , cache_(static_cast<std::size_t>(
+          std::max<std::int64_t>(0, config.cache_size_)))
 {
     Init_StorageMultiplex(primary, migrate, previous);
 }
@@ -88,7 +92,12 @@ std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
 
     try {
         localRoot.reset(new storage::Root(
-            *this, bestHash, std::numeric_limits<std::int64_t>::max(), bucket));
+            *this,
+            bestHash,
+            std::numeric_limits<std::int64_t>::max(),
+            1,
+            0,
+            bucket));
         bestVersion = localRoot->Sequence();
         bestRoot = localRoot;
     } catch (std::runtime_error&) {
@@ -105,6 +114,8 @@ std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
                 *this,
                 rootHash,
                 std::numeric_limits<std::int64_t>::max(),
+                1,
+                0,
                 bucket));
             localVersion = localRoot->Sequence();
         } catch (std::runtime_error&) {
@@ -132,7 +143,28 @@ std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
 
 void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
-void StorageMultiplex::Cleanup_StorageMultiplex() {}
+std::shared_ptr<const void> StorageMultiplex::cached(
+    const std::string& hash,
+    const std::type_info& type) const
+{
+    return cache_.Get(hash, type);
+}
+
+void StorageMultiplex::cache(
+    const std::string& hash,
+    const std::type_info& type,
+    const std::shared_ptr<const void>& object,
+    const std::size_t size) const
+{
+    cache_.Put(hash, type, object, size);
+}
+
+void StorageMultiplex::Cleanup_StorageMultiplex()
+{
+    otInfo << OT_METHOD << __FUNCTION__ << ": Object cache hits: "
+           << cache_.Hits() << ", misses: " << cache_.Misses()
+           << ", evictions: " << cache_.Evictions() << std::endl;
+}
 
 bool StorageMultiplex::EmptyBucket(const bool bucket) const
 {
@@ -370,12 +402,18 @@ void StorageMultiplex::migrate_primary(
     std::shared_ptr<storage::Root> root{nullptr};
     auto bucket = Flag::Factory(false);
     root.reset(new storage::Root(
-        *this, rootHash, std::numeric_limits<std::int64_t>::max(), bucket));
+        *this,
+        rootHash,
+        std::numeric_limits<std::int64_t>::max(),
+        1,
+        0,
+        bucket));
 
     OT_ASSERT(root);
 
     const auto& tree = root->Tree();
-    const auto migrated = tree.Migrate(*newPlugin);
+    storage::Migration migration{};
+    const auto migrated = tree.Migrate(*newPlugin, migration);
 
     if (migrated) {
         otErr << OT_METHOD << __FUNCTION__
@@ -410,6 +448,10 @@ bool StorageMultiplex::Store(
 
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
+    // Plugins keep a pointer to their promise until the write completes, so
+    // the vector must never reallocate
+    promises.reserve(1 + backup_plugins_.size());
+    futures.reserve(1 + backup_plugins_.size());
     promises.push_back(std::promise<bool>());
     auto& primaryPromise = promises.back();
     futures.push_back(primaryPromise.get_future());
@@ -488,7 +530,8 @@ void StorageMultiplex::SynchronizePlugins(
         otErr << OT_METHOD << __FUNCTION__ << ": Primary plugin is out of sync."
               << std::endl;
 
-        const auto migrated = tree.Migrate(*primary_plugin_);
+        storage::Migration migration{};
+        const auto migrated = tree.Migrate(*primary_plugin_, migration);
 
         if (migrated) {
             otErr << OT_METHOD << __FUNCTION__
@@ -510,7 +553,9 @@ void StorageMultiplex::SynchronizePlugins(
               << ": Backup plugin is uninitialized or out of sync."
               << std::endl;
 
-        if (tree.Migrate(*plugin)) {
+        storage::Migration migration{};
+
+        if (tree.Migrate(*plugin, migration)) {
             otErr << OT_METHOD << __FUNCTION__
                   << ": Successfully initialized backup plugin." << std::endl;
         } else {
@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include "storage/Cache.hpp"
+
 namespace opentxs::storage::implementation
 {
 class StorageMultiplex : virtual public opentxs::api::storage::Multiplex
@@ -62,6 +64,7 @@ private:
     const Digest digest_;
     const Random random_;
     OTSymmetricKey null_;
+    const opentxs::storage::Cache cache_;
 
     StorageMultiplex(
         const api::storage::Storage& storage,
@@ -78,6 +81,14 @@ private:
     StorageMultiplex& operator=(const StorageMultiplex&) = delete;
     StorageMultiplex& operator=(StorageMultiplex&&) = delete;
 
+    std::shared_ptr<const void> cached(
+        const std::string& hash,
+        const std::type_info& type) const override;
+    void cache(
+        const std::string& hash,
+        const std::type_info& type,
+        const std::shared_ptr<const void>& object,
+        const std::size_t size) const override;
     void Cleanup();
     void Cleanup_StorageMultiplex();
     void init(
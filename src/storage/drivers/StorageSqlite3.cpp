@@ -19,8 +19,8 @@ extern "C" {
 
 #include <atomic>
 #include <iostream>
+#include <map>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -57,47 +57,72 @@ StorageSqlite3::StorageSqlite3(
     , transaction_bucket_(Flag::Factory(false))
     , pending_()
     , db_(nullptr)
+    , statement_lock_()
+    , select_statements_()
+    , upsert_statements_()
 {
     Init_StorageSqlite3();
 }
 
-std::string StorageSqlite3::bind_key(
-    const std::string& source,
-    const std::string& key,
-    const std::size_t start) const
+bool StorageSqlite3::begin_transaction(const Lock& lock) const
 {
-    sqlite3_stmt* statement{nullptr};
-    sqlite3_prepare_v2(db_, source.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(statement, start, key.c_str(), key.size(), SQLITE_STATIC);
-    const auto output = expand_sql(statement);
-    sqlite3_finalize(statement);
+    OT_ASSERT(verify_lock(lock))
 
-    return output;
+    return (
+        SQLITE_OK ==
+        sqlite3_exec(db_, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr));
 }
 
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
-
-void StorageSqlite3::commit(std::stringstream& sql) const
+void StorageSqlite3::Cleanup_StorageSqlite3()
 {
-    sql << "COMMIT TRANSACTION;";
+    Lock lock(statement_lock_);
+
+    if (nullptr == db_) { return; }
+
+    finalize_statements(lock, select_statements_);
+    finalize_statements(lock, upsert_statements_);
+    sqlite3_close(db_);
+    db_ = nullptr;
 }
 
 bool StorageSqlite3::commit_transaction(const std::string& rootHash) const
 {
-    Lock lock(transaction_lock_);
-    std::stringstream sql{};
-    start_transaction(sql);
-    set_data(sql);
-    set_root(rootHash, sql);
-    commit(sql);
+    Lock transactionLock(transaction_lock_);
+    Lock lock(statement_lock_);
+    const auto tablename{GetTableName(transaction_bucket_.get())};
+    otInfo << OT_METHOD << __FUNCTION__ << ": Committing " << pending_.size()
+           << " objects to table " << tablename << std::endl;
+
+    if (false == begin_transaction(lock)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to start transaction: " << sqlite3_errmsg(db_)
+              << std::endl;
+        pending_.clear();
+
+        return false;
+    }
+
+    bool success{true};
+
+    for (const auto& [key, value] : pending_) {
+        success = upsert(lock, key, tablename, value);
+
+        if (false == success) { break; }
+    }
+
+    if (success) {
+        success = upsert(
+            lock,
+            config_.sqlite3_root_key_,
+            config_.sqlite3_control_table_,
+            rootHash);
+    }
+
     pending_.clear();
-    otInfo << sql.str() << std::endl;
 
-    return (
-        SQLITE_OK ==
-        sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr));
+    return end_transaction(lock, success);
 }
 
 bool StorageSqlite3::Create(const std::string& tablename) const
@@ -115,11 +140,79 @@ bool StorageSqlite3::EmptyBucket(const bool bucket) const
     return Purge(GetTableName(bucket));
 }
 
-std::string StorageSqlite3::expand_sql(sqlite3_stmt* statement) const
+bool StorageSqlite3::end_transaction(const Lock& lock, const bool success) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    if (success) {
+        if (SQLITE_OK ==
+            sqlite3_exec(db_, "COMMIT;", nullptr, nullptr, nullptr)) {
+
+            return true;
+        }
+
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to commit transaction: " << sqlite3_errmsg(db_)
+              << std::endl;
+    }
+
+    sqlite3_exec(db_, "ROLLBACK;", nullptr, nullptr, nullptr);
+
+    return false;
+}
+
+void StorageSqlite3::finalize_statements(const Lock& lock, StatementMap& map)
+    const
 {
-    const std::string output{sqlite3_expanded_sql(statement)};
+    OT_ASSERT(verify_lock(lock))
+
+    for (auto& it : map) { sqlite3_finalize(it.second); }
+
+    map.clear();
+}
+
+void StorageSqlite3::finalize_statements(
+    const Lock& lock,
+    StatementMap& map,
+    const std::string& tablename) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    auto it = map.find(tablename);
+
+    if (map.end() == it) { return; }
+
+    sqlite3_finalize(it->second);
+    map.erase(it);
+}
+
+sqlite3_stmt* StorageSqlite3::get_statement(
+    const Lock& lock,
+    StatementMap& map,
+    const std::string& tablename,
+    const std::string& query) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    auto it = map.find(tablename);
+
+    if (map.end() != it) { return it->second; }
+
+    sqlite3_stmt* statement{nullptr};
+    const auto prepared =
+        sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr);
+
+    if (SQLITE_OK != prepared) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to prepare statement ("
+              << sqlite3_errmsg(db_) << ")" << std::endl;
+        sqlite3_finalize(statement);
+
+        return nullptr;
+    }
+
+    map.emplace(tablename, statement);
 
-    return output;
+    return statement;
 }
 
 std::string StorageSqlite3::GetTableName(const bool bucket) const
@@ -174,6 +267,10 @@ std::string StorageSqlite3::LoadRoot() const
 
 bool StorageSqlite3::Purge(const std::string& tablename) const
 {
+    Lock lock(statement_lock_);
+    // Statements compiled against the dropped table must not be reused
+    finalize_statements(lock, select_statements_, tablename);
+    finalize_statements(lock, upsert_statements_, tablename);
     const std::string sql = "DROP TABLE `" + tablename + "`;";
 
     if (SQLITE_OK ==
@@ -189,12 +286,18 @@ bool StorageSqlite3::Select(
     const std::string& tablename,
     std::string& value) const
 {
-    sqlite3_stmt* statement{nullptr};
-    const std::string query =
-        "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
-    const auto sql = bind_key(query, key, 1);
-    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, 0);
-    otInfo << sql << std::endl;
+    Lock lock(statement_lock_);
+    auto statement = get_statement(
+        lock,
+        select_statements_,
+        tablename,
+        "SELECT v FROM `" + tablename + "` WHERE k = ?1;");
+
+    if (nullptr == statement) { return false; }
+
+    sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
+    otInfo << OT_METHOD << __FUNCTION__ << ": " << tablename << " " << key
+           << std::endl;
     auto result = sqlite3_step(statement);
     bool success = false;
     std::size_t retry{3};
@@ -226,84 +329,12 @@ bool StorageSqlite3::Select(
         }
     }
 
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return success;
 }
 
-void StorageSqlite3::set_data(std::stringstream& sql) const
-{
-    sqlite3_stmt* data{nullptr};
-    std::stringstream dataSQL{};
-    const std::string tablename{GetTableName(transaction_bucket_.get())};
-    dataSQL << "INSERT OR REPLACE INTO '" << tablename << "' (k, v) VALUES ";
-    std::size_t counter{0};
-    const auto size = pending_.size();
-
-    for (std::size_t i = 0; i < size; ++i) {
-        dataSQL << "(?" << ++counter << ", ?";
-        dataSQL << ++counter << ")";
-
-        if (counter < (2 * size)) {
-            dataSQL << ", ";
-        } else {
-            dataSQL << "; ";
-        }
-    }
-
-    sqlite3_prepare_v2(db_, dataSQL.str().c_str(), -1, &data, 0);
-    counter = 0;
-
-    for (const auto& it : pending_) {
-        const auto& key = it.first;
-        const auto& value = it.second;
-        auto bound = sqlite3_bind_text(
-            data, ++counter, key.c_str(), key.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-
-        bound = sqlite3_bind_blob(
-            data, ++counter, value.c_str(), value.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-    }
-
-    sql << expand_sql(data) << " ";
-    sqlite3_finalize(data);
-}
-
-void StorageSqlite3::set_root(
-    const std::string& rootHash,
-    std::stringstream& sql) const
-{
-    sqlite3_stmt* root{nullptr};
-    std::stringstream rootSQL{};
-    rootSQL << "INSERT OR REPLACE INTO '" << config_.sqlite3_control_table_
-            << "'  (k, v) VALUES (?1, ?2); ";
-    sqlite3_prepare_v2(db_, rootSQL.str().c_str(), -1, &root, 0);
-    auto bound = sqlite3_bind_text(
-        root,
-        1,
-        config_.sqlite3_root_key_.c_str(),
-        config_.sqlite3_root_key_.size(),
-        SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    bound = sqlite3_bind_blob(
-        root, 2, rootHash.c_str(), rootHash.size(), SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    sql << expand_sql(root) << " ";
-    sqlite3_finalize(root);
-}
-
-void StorageSqlite3::start_transaction(std::stringstream& sql) const
-{
-    sql << "BEGIN TRANSACTION; ";
-}
-
 void StorageSqlite3::store(
     const bool isTransaction,
     const std::string& key,
@@ -340,18 +371,56 @@ bool StorageSqlite3::Upsert(
     const std::string& tablename,
     const std::string& value) const
 {
-    sqlite3_stmt* statement;
-    const std::string query =
-        "insert or replace into `" + tablename + "` (k, v) values (?1, ?2);";
+    Lock lock(statement_lock_);
+
+    return upsert(lock, key, tablename, value);
+}
+
+bool StorageSqlite3::upsert(
+    const Lock& lock,
+    const std::string& key,
+    const std::string& tablename,
+    const std::string& value) const
+{
+    auto statement = get_statement(
+        lock,
+        upsert_statements_,
+        tablename,
+        "INSERT OR REPLACE INTO `" + tablename + "` (k, v) VALUES (?1, ?2);");
+
+    if (nullptr == statement) { return false; }
 
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
-    otInfo << expand_sql(statement) << std::endl;
+    otInfo << OT_METHOD << __FUNCTION__ << ": " << tablename << " " << key
+           << " (" << value.size() << " bytes)" << std::endl;
     const auto result = sqlite3_step(statement);
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+
+    if (SQLITE_DONE != result) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store " << key
+              << " (" << sqlite3_errmsg(db_) << ")" << std::endl;
+    }
+
+    return (SQLITE_DONE == result);
+}
+
+bool StorageSqlite3::verify_lock(const Lock& lock) const
+{
+    if (lock.mutex() != &statement_lock_) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Incorrect mutex." << std::endl;
+
+        return false;
+    }
+
+    if (false == lock.owns_lock()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Lock not owned." << std::endl;
+
+        return false;
+    }
 
-    return (result == SQLITE_DONE);
+    return true;
 }
 
 StorageSqlite3::~StorageSqlite3() { Cleanup_StorageSqlite3(); }
@@ -31,30 +31,40 @@ private:
 
     friend Factory;
 
+    using StatementMap = std::map<std::string, sqlite3_stmt*>;
+
     std::string folder_;
     mutable std::mutex transaction_lock_;
     mutable OTFlag transaction_bucket_;
     mutable std::vector<std::pair<const std::string, const std::string>>
         pending_;
     sqlite3* db_{nullptr};
+    // Protects db_ and every cached statement. Always acquired after
+    // transaction_lock_ when both are needed.
+    mutable std::mutex statement_lock_;
+    mutable StatementMap select_statements_;
+    mutable StatementMap upsert_statements_;
 
-    std::string bind_key(
-        const std::string& source,
-        const std::string& key,
-        const std::size_t start) const;
-    void commit(std::stringstream& sql) const;
+    bool begin_transaction(const Lock& lock) const;
     bool commit_transaction(const std::string& rootHash) const;
     bool Create(const std::string& tablename) const;
-    std::string expand_sql(sqlite3_stmt* statement) const;
+    bool end_transaction(const Lock& lock, const bool success) const;
+    void finalize_statements(const Lock& lock, StatementMap& map) const;
+    void finalize_statements(
+        const Lock& lock,
+        StatementMap& map,
+        const std::string& tablename) const;
     std::string GetTableName(const bool bucket) const;
+    sqlite3_stmt* get_statement(
+        const Lock& lock,
+        StatementMap& map,
+        const std::string& tablename,
+        const std::string& query) const;
     bool Select(
         const std::string& key,
         const std::string& tablename,
         std::string& value) const;
     bool Purge(const std::string& tablename) const;
-    void set_data(std::stringstream& sql) const;
-    void set_root(const std::string& rootHash, std::stringstream& sql) const;
-    void start_transaction(std::stringstream& sql) const;
     void store(
         const bool isTransaction,
         const std::string& key,
@@ -65,6 +75,12 @@ private:
         const std::string& key,
         const std::string& tablename,
         const std::string& value) const;
+    bool upsert(
+        const Lock& lock,
+        const std::string& key,
+        const std::string& tablename,
+        const std::string& value) const;
+    bool verify_lock(const Lock& lock) const;
 
     void Init_StorageSqlite3();
 
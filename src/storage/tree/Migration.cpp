@@ -0,0 +1,252 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Migration.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#define MIGRATION_CHUNK_KEY "migration"
+#define MIGRATION_CHUNK_SIZE 1024
+#define MIGRATION_PROGRESS_INTERVAL 10000
+
+#define OT_METHOD "opentxs::storage::Migration::"
+
+namespace opentxs
+{
+namespace storage
+{
+Migration::Migration()
+    : to_(nullptr)
+    , bucket_(false)
+    , threads_(1)
+    , rate_(0)
+    , no_stop_(Flag::Factory(false))
+    , stop_(no_stop_)
+    , start_(std::chrono::steady_clock::now())
+    , lock_()
+    , done_()
+    , unsaved_()
+    , chunk_(0)
+    , parallel_(false)
+    , copied_(0)
+    , skipped_(0)
+    , failed_(0)
+{
+}
+
+Migration::Migration(
+    const opentxs::api::storage::Driver& to,
+    const bool bucket,
+    const std::size_t threads,
+    const std::uint64_t rate,
+    const Flag& stop)
+    : to_(&to)
+    , bucket_(bucket)
+    , threads_(std::max<std::size_t>(threads, 1))
+    , rate_(rate)
+    , no_stop_(Flag::Factory(false))
+    , stop_(stop)
+    , start_(std::chrono::steady_clock::now())
+    , lock_()
+    , done_()
+    , unsaved_()
+    , chunk_(0)
+    , parallel_(false)
+    , copied_(0)
+    , skipped_(0)
+    , failed_(0)
+{
+}
+
+std::string Migration::chunk_key(const std::uint64_t chunk)
+{
+    return MIGRATION_CHUNK_KEY + std::to_string(chunk);
+}
+
+bool Migration::Copy(
+    const opentxs::api::storage::Driver& from,
+    const std::string& hash,
+    const opentxs::api::storage::Driver& to)
+{
+    if (stop_) { return false; }
+
+    if (done(hash)) {
+        ++skipped_;
+
+        return true;
+    }
+
+    if (false == from.Migrate(hash, to)) {
+        ++failed_;
+
+        return false;
+    }
+
+    finish(hash);
+    ++copied_;
+    progress();
+    throttle();
+
+    return true;
+}
+
+bool Migration::done(const std::string& hash) const
+{
+    Lock lock(lock_);
+
+    return 0 < done_.count(hash);
+}
+
+void Migration::finish(const std::string& hash)
+{
+    Lock lock(lock_);
+
+    // Once anything has failed this pass will be retried from the beginning,
+    // and a subtree root recorded after a failed child would be a lie
+    if (0 < failed_.load()) { return; }
+
+    if (false == done_.emplace(hash).second) { return; }
+
+    if (nullptr == to_) { return; }
+
+    unsaved_.emplace_back(hash);
+
+    if (MIGRATION_CHUNK_SIZE <= unsaved_.size()) { save(lock); }
+}
+
+void Migration::Load()
+{
+    if (nullptr == to_) { return; }
+
+    Lock lock(lock_);
+    std::string value{};
+
+    while (to_->LoadFromBucket(chunk_key(chunk_), value, bucket_)) {
+        std::istringstream stream(value);
+        std::string hash{};
+
+        while (std::getline(stream, hash)) {
+            if (false == hash.empty()) { done_.emplace(hash); }
+        }
+
+        ++chunk_;
+    }
+
+    if (0 < chunk_) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Resuming with "
+              << done_.size() << " objects already migrated." << std::endl;
+    }
+}
+
+bool Migration::Parallel(
+    const std::size_t count,
+    const std::function<bool(const std::size_t)>& job)
+{
+    const auto workers = std::min(threads_, count);
+
+    // Nested sections run on the calling thread so the total number of
+    // threads copying objects never exceeds threads_
+    if ((2 > workers) || parallel_.exchange(true)) {
+        bool output{true};
+
+        for (std::size_t i = 0; i < count; ++i) { output &= job(i); }
+
+        return output;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> output{true};
+    auto worker = [&]() -> void {
+        for (auto i = next++; i < count; i = next++) {
+            if (false == job(i)) { output.store(false); }
+        }
+    };
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i = 1; i < workers; ++i) { threads.emplace_back(worker); }
+
+    worker();
+
+    for (auto& thread : threads) { thread.join(); }
+
+    parallel_.store(false);
+
+    return output.load();
+}
+
+void Migration::progress() const
+{
+    const auto copied = copied_.load();
+
+    if (0 != copied % MIGRATION_PROGRESS_INTERVAL) { return; }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - start_);
+    otWarn << OT_METHOD << __FUNCTION__ << ": " << copied
+           << " objects copied, " << skipped_.load() << " skipped, "
+           << failed_.load() << " failed in " << elapsed.count() << " seconds."
+           << std::endl;
+}
+
+void Migration::Save()
+{
+    Lock lock(lock_);
+    save(lock);
+}
+
+bool Migration::save(Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if ((nullptr == to_) || unsaved_.empty() || (0 < failed_.load())) {
+        return true;
+    }
+
+    std::string value{};
+
+    for (const auto& hash : unsaved_) { value += hash + "\n"; }
+
+    if (false == to_->Store(false, chunk_key(chunk_), value, bucket_)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to record progress."
+              << std::endl;
+
+        return false;
+    }
+
+    ++chunk_;
+    unsaved_.clear();
+
+    return true;
+}
+
+bool Migration::Skip(const std::string& hash)
+{
+    if (done(hash)) {
+        ++skipped_;
+
+        return true;
+    }
+
+    return false;
+}
+
+void Migration::throttle() const
+{
+    if (0 == rate_) { return; }
+
+    // Each object is allotted 1 / rate_ seconds measured from the start of
+    // the pass, so a slow stretch is made up for rather than compounded
+    const auto target =
+        start_ + std::chrono::microseconds(copied_.load() * 1000000 / rate_);
+    std::this_thread::sleep_until(target);
+}
+}  // namespace storage
+}  // namespace opentxs
@@ -0,0 +1,103 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/api/storage/Driver.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "opentxs/Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace opentxs
+{
+namespace storage
+{
+/** State shared by every node during one pass which copies a storage tree
+ *  into another bucket or plugin.
+ *
+ *  Hashes are recorded once they exist in the destination so that shared
+ *  objects are copied once, and a subtree whose root hash has been recorded
+ *  is skipped entirely. When constructed with a destination bucket the
+ *  record is appended in chunks to that bucket, which allows an interrupted
+ *  pass to resume. The chunks are erased along with the objects they
+ *  describe when the bucket is emptied, so they never refer to objects which
+ *  are no longer present.
+ */
+class Migration
+{
+public:
+    /** Copy one object, unless it was already copied during this pass */
+    bool Copy(
+        const opentxs::api::storage::Driver& from,
+        const std::string& hash,
+        const opentxs::api::storage::Driver& to);
+    std::uint64_t Copied() const { return copied_.load(); }
+    std::uint64_t Failed() const { return failed_.load(); }
+    /** Load any progress recorded in the destination bucket */
+    void Load();
+    /** Run count jobs, spreading them over the worker threads unless another
+     *  parallel section of this pass is already running */
+    bool Parallel(
+        const std::size_t count,
+        const std::function<bool(const std::size_t)>& job);
+    /** Write any unsaved progress to the destination bucket */
+    void Save();
+    /** Returns true if the subtree rooted at hash is already complete */
+    bool Skip(const std::string& hash);
+    std::uint64_t Skipped() const { return skipped_.load(); }
+    bool Stopped() const { return stop_; }
+
+    Migration();
+    Migration(
+        const opentxs::api::storage::Driver& to,
+        const bool bucket,
+        const std::size_t threads,
+        const std::uint64_t rate,
+        const Flag& stop);
+
+    ~Migration() = default;
+
+private:
+    const opentxs::api::storage::Driver* const to_{nullptr};
+    const bool bucket_{false};
+    const std::size_t threads_{1};
+    const std::uint64_t rate_{0};
+    const OTFlag no_stop_;
+    const Flag& stop_;
+    const std::chrono::steady_clock::time_point start_;
+    mutable std::mutex lock_;
+    std::unordered_set<std::string> done_;
+    std::vector<std::string> unsaved_;
+    std::uint64_t chunk_{0};
+    std::atomic<bool> parallel_{false};
+    std::atomic<std::uint64_t> copied_{0};
+    std::atomic<std::uint64_t> skipped_{0};
+    std::atomic<std::uint64_t> failed_{0};
+
+    static std::string chunk_key(const std::uint64_t chunk);
+
+    bool done(const std::string& hash) const;
+    void finish(const std::string& hash);
+    void progress() const;
+    bool save(Lock& lock);
+    void throttle() const;
+
+    Migration(const Migration&) = delete;
+    Migration(Migration&&) = delete;
+    Migration& operator=(const Migration&) = delete;
+    Migration& operator=(Migration&&) = delete;
+};
+}  // namespace storage
+}  // namespace opentxs
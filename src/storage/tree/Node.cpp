@@ -10,6 +10,9 @@
 #include "opentxs/core/Log.hpp"
 
 #include "storage/Plugin.hpp"
+#include "Migration.hpp"
+
+#include <vector>
 
 #define OT_METHOD "opentxs::storage::Node::"
 
@@ -115,14 +118,17 @@ bool Node::load_raw(
 
 bool Node::migrate(
     const std::string& hash,
-    const opentxs::api::storage::Driver& to) const
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
     if (false == check_hash(hash)) { return true; }
 
-    return driver_.Migrate(hash, to);
+    return state.Copy(driver_, hash, to);
 }
 
-bool Node::Migrate(const opentxs::api::storage::Driver& to) const
+bool Node::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
     if (std::string(BLANK_HASH) == root_) {
         if (0 < item_map_.size()) {
@@ -136,14 +142,22 @@ bool Node::Migrate(const opentxs::api::storage::Driver& to) const
         return true;
     }
 
-    bool output{true};
-    output &= migrate(root_, to);
+    if (state.Skip(root_)) { return true; }
+
+    std::vector<std::string> hashes{};
 
     for (const auto& item : item_map_) {
-        const auto& hash = std::get<0>(item.second);
-        output &= migrate(hash, to);
+        hashes.emplace_back(std::get<0>(item.second));
     }
 
+    bool output = state.Parallel(
+        hashes.size(), [&](const std::size_t i) -> bool {
+            return migrate(hashes.at(i), to, state);
+        });
+    // The root is copied last so that recording it marks the whole subtree
+    // as complete
+    output &= migrate(root_, to, state);
+
     return output;
 }
 
@@ -22,6 +22,7 @@ namespace opentxs
 {
 namespace storage
 {
+class Migration;
 class Root;
 
 typedef std::function<bool(const std::string&)> keyFunction;
@@ -193,7 +194,8 @@ protected:
         const bool checking) const;
     bool migrate(
         const std::string& hash,
-        const opentxs::api::storage::Driver& to) const;
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const;
     virtual bool save(const Lock& lock) const = 0;
     void serialize_index(
         const std::string& id,
@@ -227,7 +229,9 @@ protected:
 
 public:
     virtual ObjectList List() const;
-    virtual bool Migrate(const opentxs::api::storage::Driver& to) const;
+    virtual bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const;
     std::string Root() const;
     std::uint32_t UpgradeLevel() const;
 
@@ -12,6 +12,7 @@
 #include "Contexts.hpp"
 #include "Issuers.hpp"
 #include "Mailbox.hpp"
+#include "Migration.hpp"
 #include "PaymentWorkflows.hpp"
 #include "PeerReplies.hpp"
 #include "PeerRequests.hpp"
@@ -367,26 +368,30 @@ const Mailbox& Nym::MailInbox() const { return *mail_inbox(); }
 
 const Mailbox& Nym::MailOutbox() const { return *mail_outbox(); }
 
-bool Nym::Migrate(const opentxs::api::storage::Driver& to) const
+bool Nym::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
+    if (state.Skip(root_)) { return true; }
+
     bool output{true};
-    output &= migrate(credentials_, to);
-    output &= sent_request_box()->Migrate(to);
-    output &= incoming_request_box()->Migrate(to);
-    output &= sent_reply_box()->Migrate(to);
-    output &= incoming_reply_box()->Migrate(to);
-    output &= finished_request_box()->Migrate(to);
-    output &= finished_reply_box()->Migrate(to);
-    output &= processed_request_box()->Migrate(to);
-    output &= processed_reply_box()->Migrate(to);
-    output &= mail_inbox()->Migrate(to);
-    output &= mail_outbox()->Migrate(to);
-    output &= threads()->Migrate(to);
-    output &= contexts()->Migrate(to);
-    output &= issuers()->Migrate(to);
-    output &= workflows()->Migrate(to);
-    output &= bip47()->Migrate(to);
-    output &= migrate(root_, to);
+    output &= migrate(credentials_, to, state);
+    output &= sent_request_box()->Migrate(to, state);
+    output &= incoming_request_box()->Migrate(to, state);
+    output &= sent_reply_box()->Migrate(to, state);
+    output &= incoming_reply_box()->Migrate(to, state);
+    output &= finished_request_box()->Migrate(to, state);
+    output &= finished_reply_box()->Migrate(to, state);
+    output &= processed_request_box()->Migrate(to, state);
+    output &= processed_reply_box()->Migrate(to, state);
+    output &= mail_inbox()->Migrate(to, state);
+    output &= mail_outbox()->Migrate(to, state);
+    output &= threads()->Migrate(to, state);
+    output &= contexts()->Migrate(to, state);
+    output &= issuers()->Migrate(to, state);
+    output &= workflows()->Migrate(to, state);
+    output &= bip47()->Migrate(to, state);
+    output &= migrate(root_, to, state);
 
     return output;
 }
@@ -68,7 +68,9 @@ public:
         std::shared_ptr<proto::CredentialIndex>& output,
         std::string& alias,
         const bool checking) const;
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const override;
 
     bool SetAlias(const std::string& alias);
     bool Store(
@@ -10,11 +10,13 @@
 #include "storage/Plugin.hpp"
 #include "Contexts.hpp"
 #include "Mailbox.hpp"
+#include "Migration.hpp"
 #include "Nym.hpp"
 #include "Thread.hpp"
 #include "Threads.hpp"
 
 #include <functional>
+#include <vector>
 
 #define CURRENT_VERSION 3
 
@@ -99,17 +101,20 @@ void Nyms::Map(NymLambda lambda) const
     }
 }
 
-bool Nyms::Migrate(const opentxs::api::storage::Driver& to) const
+bool Nyms::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
-    bool output{true};
+    if (state.Skip(root_)) { return true; }
 
-    for (const auto index : item_map_) {
-        const auto& id = index.first;
-        const auto& node = *nym(id);
-        output &= node.Migrate(to);
-    }
+    std::vector<std::string> ids{};
+
+    for (const auto& index : item_map_) { ids.emplace_back(index.first); }
 
-    output &= migrate(root_, to);
+    bool output = state.Parallel(ids.size(), [&](const std::size_t i) -> bool {
+        return nym(ids.at(i))->Migrate(to, state);
+    });
+    output &= migrate(root_, to, state);
 
     return output;
 }
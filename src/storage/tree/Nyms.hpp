@@ -54,7 +54,9 @@ public:
     bool Exists(const std::string& id) const;
     const std::set<std::string> LocalNyms() const;
     void Map(NymLambda lambda) const;
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const override;
     const class Nym& Nym(const std::string& id) const;
 
     Editor<class Nym> mutable_Nym(const std::string& id);
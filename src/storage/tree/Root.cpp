@@ -15,6 +15,7 @@
 #include "BlockchainTransactions.hpp"
 #include "Contacts.hpp"
 #include "Credentials.hpp"
+#include "Migration.hpp"
 #include "Node.hpp"
 #include "Nym.hpp"
 #include "Nyms.hpp"
@@ -35,12 +36,17 @@ Root::Root(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
     const std::int64_t interval,
+    const std::size_t gcThreads,
+    const std::uint64_t gcRate,
     Flag& bucket)
     : ot_super(storage, hash)
     , gc_interval_(interval)
+    , gc_threads_(gcThreads)
+    , gc_rate_(gcRate)
     , current_bucket_(bucket)
     , gc_running_(Flag::Factory(false))
     , gc_resume_(Flag::Factory(false))
+    , gc_stop_(Flag::Factory(false))
 {
     if (check_hash(hash)) {
         init(hash);
@@ -57,13 +63,14 @@ Root::Root(
 
 void Root::cleanup() const
 {
+    gc_stop_->On();
     Lock gclock(gc_lock_);
+    std::unique_ptr<std::thread> thread{gc_thread_.release()};
+    gclock.unlock();
 
-    if (gc_thread_) {
-        if (gc_thread_->joinable()) { gc_thread_->join(); }
-
-        gc_thread_.reset();
-    }
+    // collect_garbage takes gc_lock_ before it returns, so the join must
+    // happen without holding it
+    if (thread && thread->joinable()) { thread->join(); }
 }
 
 void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
@@ -85,10 +92,23 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
     lock.unlock();
     bool success{false};
+    Migration migration(*to, !oldLocation, gc_threads_, gc_rate_, gc_stop_);
 
     if (Node::check_hash(gc_root_)) {
+        migration.Load();
         const class Tree tree(driver_, gc_root_);
-        success = tree.Migrate(*to);
+        success = tree.Migrate(*to, migration);
+        migration.Save();
+    }
+
+    if ((false == success) && migration.Stopped()) {
+        // The stored root still indicates a collection in progress, so the
+        // next session resumes from the recorded progress
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Garbage collection interrupted after copying "
+              << migration.Copied() << " objects." << std::endl;
+
+        return;
     }
 
     if (success) {
@@ -107,8 +127,9 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     driver_.StoreRoot(true, root_);
     lock.unlock();
     gcLock.unlock();
-    otErr << OT_METHOD << __FUNCTION__ << ": Finished garbage collection."
-          << std::endl;
+    otErr << OT_METHOD << __FUNCTION__ << ": Finished garbage collection. "
+          << migration.Copied() << " objects copied, " << migration.Skipped()
+          << " skipped, " << migration.Failed() << " failed." << std::endl;
 }
 
 void Root::init(const std::string& hash)
@@ -154,6 +175,7 @@ bool Root::Migrate(const opentxs::api::storage::Driver& to) const
 
         if (!running) {
             cleanup();
+            gc_stop_->Off();
             gc_thread_.reset(
                 new std::thread(&Root::collect_garbage, this, &to));
 
@@ -45,10 +45,13 @@ private:
     friend class api::storage::implementation::Storage;
 
     const std::uint64_t gc_interval_{std::numeric_limits<std::int64_t>::max()};
+    const std::size_t gc_threads_{1};
+    const std::uint64_t gc_rate_{0};
     mutable std::string gc_root_;
     Flag& current_bucket_;
     mutable OTFlag gc_running_;
     mutable OTFlag gc_resume_;
+    mutable OTFlag gc_stop_;
     mutable std::atomic<std::uint64_t> last_gc_;
     mutable std::atomic<std::uint64_t> sequence_;
     mutable std::mutex gc_lock_;
@@ -71,6 +74,8 @@ private:
         const opentxs::api::storage::Driver& storage,
         const std::string& hash,
         const std::int64_t interval,
+        const std::size_t gcThreads,
+        const std::uint64_t gcRate,
         Flag& bucket);
     Root() = delete;
     Root(const Root&) = delete;
@@ -83,7 +88,7 @@ public:
 
     Editor<class Tree> mutable_Tree();
 
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(const opentxs::api::storage::Driver& to) const;
     bool Save(const opentxs::api::storage::Driver& to) const;
     std::uint64_t Sequence() const;
 
@@ -14,6 +14,9 @@
 #include "storage/Plugin.hpp"
 #include "Mailbox.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
@@ -33,6 +36,8 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , thread_()
+    , items_()
     , participants_()
 {
     if (check_hash(hash)) {
@@ -53,6 +58,8 @@ Thread::Thread(
     , id_(id)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , thread_()
+    , items_()
     , participants_(participants)
 {
     version_ = 1;
@@ -70,6 +77,13 @@ bool Thread::Add(
 {
     Lock lock(write_lock_);
 
+    if (id.empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Missing item id."
+              << std::endl;
+
+        return false;
+    }
+
     bool saved{false};
     bool unread{true};
 
@@ -108,7 +122,7 @@ bool Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
+    proto::StorageThreadItem item{};
     item.set_version(version_);
     item.set_id(id);
 
@@ -125,11 +139,11 @@ bool Thread::Add(
 
     const bool valid = proto::Validate(item, VERBOSE);
 
-    if (!valid) {
-        items_.erase(id);
+    if (!valid) { return false; }
 
-        return false;
-    }
+    if (items_.end() != items_.find(id)) { erase(lock, id); }
+
+    insert(lock, item);
 
     return save(lock);
 }
@@ -160,17 +174,48 @@ void Thread::init(const std::string& hash)
         participants_.emplace(participant);
     }
 
+    Lock lock(write_lock_);
+
     for (const auto& it : serialized->item()) {
         const auto& index = it.index();
-        items_.emplace(it.id(), it);
+
+        if (it.id().empty()) { continue; }
+
+        insert(lock, it);
 
         if (index >= index_) { index_ = index + 1; }
     }
 
-    Lock lock(write_lock_);
     upgrade(lock);
 }
 
+void Thread::erase(const Lock& lock, const std::string& id)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto it = items_.find(id);
+
+    if (items_.end() == it) { return; }
+
+    OT_ASSERT(nullptr != it->second);
+
+    const auto key = sort_key(*it->second);
+    auto& list = *thread_.mutable_item();
+    const auto position = std::lower_bound(
+        list.begin(),
+        list.end(),
+        key,
+        [](const proto::StorageThreadItem& lhs, const SortKey& rhs) -> bool {
+            return sort_key(lhs) < rhs;
+        });
+
+    OT_ASSERT(list.end() != position);
+    OT_ASSERT(position->id() == id);
+
+    items_.erase(it);
+    list.DeleteSubrange(std::distance(list.begin(), position), 1);
+}
+
 bool Thread::Check(const std::string& id) const
 {
     Lock lock(write_lock_);
@@ -180,6 +225,29 @@ bool Thread::Check(const std::string& id) const
 
 std::string Thread::ID() const { return id_; }
 
+void Thread::insert(const Lock& lock, const proto::StorageThreadItem& item)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& list = *thread_.mutable_item();
+    auto* added = list.Add();
+
+    OT_ASSERT(nullptr != added);
+
+    *added = item;
+    const auto key = sort_key(*added);
+
+    // New items almost always sort last, so only out of order insertions pay
+    // for moving existing entries
+    for (auto i = list.size() - 1; 0 < i; --i) {
+        if (sort_key(list.Get(i - 1)) < key) { break; }
+
+        list.SwapElements(i, i - 1);
+    }
+
+    items_[item.id()] = added;
+}
+
 proto::StorageThread Thread::Items() const
 {
     Lock lock(write_lock_);
@@ -187,9 +255,11 @@ proto::StorageThread Thread::Items() const
     return serialize(lock);
 }
 
-bool Thread::Migrate(const opentxs::api::storage::Driver& to) const
+bool Thread::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
-    return Node::migrate(root_, to);
+    return Node::migrate(root_, to, state);
 }
 
 bool Thread::Read(const std::string& id, const bool unread)
@@ -205,9 +275,11 @@ bool Thread::Read(const std::string& id, const bool unread)
         return false;
     }
 
-    auto& item = it->second;
+    auto* item = it->second;
 
-    item.set_unread(unread);
+    OT_ASSERT(nullptr != item);
+
+    item->set_unread(unread);
 
     return save(lock);
 }
@@ -220,9 +292,10 @@ bool Thread::Remove(const std::string& id)
 
     if (items_.end() == it) { return false; }
 
-    auto& item = it->second;
-    StorageBox box = static_cast<StorageBox>(item.box());
-    items_.erase(it);
+    OT_ASSERT(nullptr != it->second);
+
+    StorageBox box = static_cast<StorageBox>(it->second->box());
+    erase(lock, id);
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -258,35 +331,23 @@ bool Thread::save(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
-
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
-
-    return driver_.StoreProto(serialized, root_);
+    // StoreProto validates the serialized thread before writing it
+    return driver_.StoreProto(serialize(lock), root_);
 }
 
-proto::StorageThread Thread::serialize(const Lock& lock) const
+const proto::StorageThread& Thread::serialize(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    proto::StorageThread serialized;
-    serialized.set_version(version_);
-    serialized.set_id(id_);
+    thread_.set_version(version_);
+    thread_.set_id(id_);
+    thread_.clear_participant();
 
     for (const auto nym : participants_) {
-        if (!nym.empty()) { *serialized.add_participant() = nym; }
+        if (!nym.empty()) { *thread_.add_participant() = nym; }
     }
 
-    auto sorted = sort(lock);
-
-    for (const auto& it : sorted) {
-        OT_ASSERT(nullptr != it.second);
-
-        const auto& item = *it.second;
-        *serialized.add_item() = item;
-    }
-
-    return serialized;
+    return thread_;
 }
 
 bool Thread::SetAlias(const std::string& alias)
@@ -298,23 +359,9 @@ bool Thread::SetAlias(const std::string& alias)
     return true;
 }
 
-Thread::SortedItems Thread::sort(const Lock& lock) const
+Thread::SortKey Thread::sort_key(const proto::StorageThreadItem& item)
 {
-    OT_ASSERT(verify_write_lock(lock));
-
-    SortedItems output;
-
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
-
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
-        }
-    }
-
-    return output;
+    return SortKey{item.index(), item.time(), item.id()};
 }
 
 std::size_t Thread::UnreadCount() const
@@ -322,9 +369,7 @@ std::size_t Thread::UnreadCount() const
     Lock lock(write_lock_);
     std::size_t output{0};
 
-    for (const auto& it : items_) {
-        const auto& item = it.second;
-
+    for (const auto& item : thread_.item()) {
         if (item.unread()) { ++output; }
     }
 
@@ -337,8 +382,7 @@ void Thread::upgrade(const Lock& lock)
 
     bool changed{false};
 
-    for (auto& it : items_) {
-        auto& item = it.second;
+    for (auto& item : *thread_.mutable_item()) {
         const auto box = static_cast<StorageBox>(item.box());
 
         switch (box) {
@@ -30,23 +30,28 @@ class Thread : public Node
 private:
     friend class Threads;
     typedef std::tuple<std::size_t, std::int64_t, std::string> SortKey;
-    typedef std::map<SortKey, const proto::StorageThreadItem*> SortedItems;
 
     std::string id_;
     std::string alias_;
     std::size_t index_{0};
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    // Items are kept in serialized form, already in sort order, so that
+    // appending an item does not require rebuilding the whole thread
+    mutable proto::StorageThread thread_;
+    std::map<std::string, proto::StorageThreadItem*> items_;
 
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
 
+    static SortKey sort_key(const proto::StorageThreadItem& item);
+
+    void erase(const Lock& lock, const std::string& id);
     void init(const std::string& hash) override;
+    void insert(const Lock& lock, const proto::StorageThreadItem& item);
     bool save(const Lock& lock) const override;
-    proto::StorageThread serialize(const Lock& lock) const;
-    SortedItems sort(const Lock& lock) const;
+    const proto::StorageThread& serialize(const Lock& lock) const;
     void upgrade(const Lock& lock);
 
     Thread(
@@ -73,7 +78,9 @@ public:
     bool Check(const std::string& id) const;
     std::string ID() const;
     proto::StorageThread Items() const;
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const override;
     std::size_t UnreadCount() const;
 
     bool Add(
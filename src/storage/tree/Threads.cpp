@@ -8,6 +8,7 @@
 #include "Threads.hpp"
 
 #include "storage/Plugin.hpp"
+#include "Migration.hpp"
 #include "Thread.hpp"
 
 #include <utility>
@@ -15,6 +16,7 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <vector>
 
 #define OT_METHOD "opentxs::storage::Threads::"
 
@@ -30,6 +32,9 @@ Threads::Threads(
     : Node(storage, hash)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , unread_()
+    , unread_total_(0)
+    , unread_loaded_(false)
 {
     if (check_hash(hash)) {
         init(hash);
@@ -61,9 +66,15 @@ std::string Threads::create(
     auto& node = threads_[id];
 
     if (false == bool(node)) {
-        Lock threadLock(newThread->write_lock_);
-        newThread->save(threadLock);
+        {
+            Lock threadLock(newThread->write_lock_);
+            newThread->save(threadLock);
+        }
+
+        // UnreadCount locks the thread, so it must not be held here
+        const auto unread = newThread->UnreadCount();
         node.swap(newThread);
+        set_unread(lock, id, unread);
         save(lock);
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Thread already exists."
@@ -102,6 +113,7 @@ bool Threads::FindAndDeleteItem(const std::string& itemID)
 
         if (hasItem) {
             node.Remove(itemID);
+            set_unread(lock, id, node.UnreadCount());
             found = true;
         }
     }
@@ -139,31 +151,58 @@ ObjectList Threads::List(const bool unreadOnly) const
 
     ObjectList output{};
     Lock lock(write_lock_);
+    load_unread(lock);
+
+    for (const auto& [threadID, count] : unread_) {
+        if (0 == count) { continue; }
+
+        auto it = item_map_.find(threadID);
+
+        if (item_map_.end() == it) { continue; }
+
+        output.push_back({threadID, std::get<1>(it->second)});
+    }
+
+    return output;
+}
+
+void Threads::load_unread(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (unread_loaded_) { return; }
+
+    unread_.clear();
+    unread_total_ = 0;
 
     for (const auto& it : item_map_) {
         const auto& threadID = it.first;
-        const auto& alias = std::get<1>(it.second);
         auto thread = Threads::thread(threadID, lock);
 
         OT_ASSERT(nullptr != thread);
 
-        if (0 < thread->UnreadCount()) { output.push_back({threadID, alias}); }
+        const auto count = thread->UnreadCount();
+        unread_.emplace(threadID, count);
+        unread_total_ += count;
     }
 
-    return output;
+    unread_loaded_ = true;
 }
 
-bool Threads::Migrate(const opentxs::api::storage::Driver& to) const
+bool Threads::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
-    bool output{true};
+    if (state.Skip(root_)) { return true; }
 
-    for (const auto index : item_map_) {
-        const auto& id = index.first;
-        const auto& node = *thread(id);
-        output &= node.Migrate(to);
-    }
+    std::vector<std::string> ids{};
+
+    for (const auto& index : item_map_) { ids.emplace_back(index.first); }
 
-    output &= migrate(root_, to);
+    bool output = state.Parallel(ids.size(), [&](const std::size_t i) -> bool {
+        return thread(ids.at(i))->Migrate(to, state);
+    });
+    output &= migrate(root_, to, state);
 
     return output;
 }
@@ -254,6 +293,17 @@ bool Threads::Rename(const std::string& existingID, const std::string& newID)
 
     newThread.reset(oldThread.release());
     threads_.erase(threadItem);
+
+    if (unread_loaded_) {
+        auto unread = unread_.find(existingID);
+
+        if (unread_.end() != unread) {
+            const auto count = unread->second;
+            unread_.erase(unread);
+            unread_[newID] = count;
+        }
+    }
+
     threads_.emplace(
         newID, std::unique_ptr<opentxs::storage::Thread>(newThread.release()));
     item_map_.erase(it);
@@ -296,6 +346,7 @@ void Threads::save(
     auto& alias = std::get<1>(index);
     hash = nym->Root();
     alias = nym->Alias();
+    set_unread(lock, id, nym->UnreadCount());
 
     if (!save(lock)) {
         std::cerr << __FUNCTION__ << ": Save error" << std::endl;
@@ -303,6 +354,22 @@ void Threads::save(
     }
 }
 
+void Threads::set_unread(
+    const Lock& lock,
+    const std::string& id,
+    const std::size_t count) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    // The next call to load_unread will count every thread anyway
+    if (false == unread_loaded_) { return; }
+
+    auto& existing = unread_[id];
+    unread_total_ -= existing;
+    existing = count;
+    unread_total_ += count;
+}
+
 proto::StorageNymList Threads::serialize() const
 {
     proto::StorageNymList serialized;
@@ -320,5 +387,24 @@ proto::StorageNymList Threads::serialize() const
 
     return serialized;
 }
+
+std::size_t Threads::UnreadCount() const
+{
+    Lock lock(write_lock_);
+    load_unread(lock);
+
+    return unread_total_;
+}
+
+std::size_t Threads::UnreadCount(const std::string& id) const
+{
+    Lock lock(write_lock_);
+    load_unread(lock);
+    const auto it = unread_.find(id);
+
+    if (unread_.end() == it) { return 0; }
+
+    return it->second;
+}
 }  // namespace storage
 }  // namespace opentxs
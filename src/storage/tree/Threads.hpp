@@ -35,6 +35,11 @@ private:
     mutable std::map<std::string, std::unique_ptr<class Thread>> threads_;
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
+    // Number of unread items in each thread. Counted once on first use, then
+    // kept current by every operation which modifies a thread.
+    mutable std::map<std::string, std::size_t> unread_;
+    mutable std::size_t unread_total_{0};
+    mutable bool unread_loaded_{false};
 
     bool save(const std::unique_lock<std::mutex>& lock) const override;
     proto::StorageNymList serialize() const;
@@ -48,10 +53,15 @@ private:
         const std::string& id,
         const std::set<std::string>& participants);
     void init(const std::string& hash) override;
+    void load_unread(const Lock& lock) const;
     void save(
         class Thread* thread,
         const std::unique_lock<std::mutex>& lock,
         const std::string& id);
+    void set_unread(
+        const Lock& lock,
+        const std::string& id,
+        const std::size_t count) const;
 
     Threads(
         const opentxs::api::storage::Driver& storage,
@@ -68,8 +78,12 @@ public:
     bool Exists(const std::string& id) const;
     using ot_super::List;
     ObjectList List(const bool unreadOnly) const;
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const override;
     const class Thread& Thread(const std::string& id) const;
+    std::size_t UnreadCount() const;
+    std::size_t UnreadCount(const std::string& id) const;
 
     std::string Create(
         const std::string& id,
@@ -12,6 +12,7 @@
 #include "BlockchainTransactions.hpp"
 #include "Contacts.hpp"
 #include "Credentials.hpp"
+#include "Migration.hpp"
 #include "Nym.hpp"
 #include "Nyms.hpp"
 #include "Seeds.hpp"
@@ -221,18 +222,22 @@ void Tree::init(const std::string& hash)
     unit_root_ = normalize_hash(serialized->units());
 }
 
-bool Tree::Migrate(const opentxs::api::storage::Driver& to) const
+bool Tree::Migrate(
+    const opentxs::api::storage::Driver& to,
+    Migration& state) const
 {
+    if (state.Skip(root_)) { return true; }
+
     bool output{true};
-    output &= accounts()->Migrate(to);
-    output &= blockchain()->Migrate(to);
-    output &= contacts()->Migrate(to);
-    output &= credentials()->Migrate(to);
-    output &= nyms()->Migrate(to);
-    output &= seeds()->Migrate(to);
-    output &= servers()->Migrate(to);
-    output &= units()->Migrate(to);
-    output &= migrate(root_, to);
+    output &= accounts()->Migrate(to, state);
+    output &= blockchain()->Migrate(to, state);
+    output &= contacts()->Migrate(to, state);
+    output &= credentials()->Migrate(to, state);
+    output &= nyms()->Migrate(to, state);
+    output &= seeds()->Migrate(to, state);
+    output &= servers()->Migrate(to, state);
+    output &= units()->Migrate(to, state);
+    output &= migrate(root_, to, state);
 
     return output;
 }
@@ -39,7 +39,9 @@ public:
     Editor<Servers> mutable_Servers();
     Editor<Units> mutable_Units();
 
-    bool Migrate(const opentxs::api::storage::Driver& to) const override;
+    bool Migrate(
+        const opentxs::api::storage::Driver& to,
+        Migration& state) const override;
 
     ~Tree();
 
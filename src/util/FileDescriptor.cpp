@@ -0,0 +1,79 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "FileDescriptor.hpp"
+
+#include <cerrno>
+#include <cstddef>
+
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+namespace opentxs
+{
+FileDescriptor::FileDescriptor(
+    const std::string& path,
+    const int flags,
+    const ::mode_t mode)
+    : fd_(::open(path.c_str(), flags, mode))
+{
+}
+
+bool FileDescriptor::Sync(const int fd)
+{
+#if defined(__APPLE__)
+    // This is a Mac OS X system which does not implement
+    // fsync as such.
+    return 0 == ::fcntl(fd, F_FULLFSYNC);
+#else
+    return 0 == ::fsync(fd);
+#endif
+}
+
+bool FileDescriptor::Sync() const
+{
+    if (false == good()) { return false; }
+
+    return Sync(fd_);
+}
+
+bool FileDescriptor::SyncDirectory(const std::string& path)
+{
+    FileDescriptor fd(path, O_DIRECTORY | O_RDONLY);
+
+    return fd.Sync();
+}
+
+bool FileDescriptor::Write(const std::string& data) const
+{
+    if (false == good()) { return false; }
+
+    std::size_t position{0};
+
+    while (position < data.size()) {
+        const auto bytes =
+            ::write(fd_, data.data() + position, data.size() - position);
+
+        if (0 < bytes) {
+            position += static_cast<std::size_t>(bytes);
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FileDescriptor::~FileDescriptor()
+{
+    if (good()) { ::close(fd_); }
+}
+}  // namespace opentxs
@@ -0,0 +1,52 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <string>
+
+extern "C" {
+#include <sys/types.h>
+}
+
+namespace opentxs
+{
+/** Owns a POSIX file descriptor, which is closed on destruction */
+class FileDescriptor
+{
+public:
+    /** Flushes a file or directory to disk */
+    static bool Sync(const int fd);
+    /** Flushes a directory, making new and renamed entries durable */
+    static bool SyncDirectory(const std::string& path);
+
+    operator bool() const { return good(); }
+    operator int() const { return fd_; }
+
+    bool Sync() const;
+    /** Writes all of data, retrying short and interrupted writes */
+    bool Write(const std::string& data) const;
+
+    FileDescriptor(
+        const std::string& path,
+        const int flags,
+        const ::mode_t mode = 0);
+
+    ~FileDescriptor();
+
+private:
+    int fd_{-1};
+
+    bool good() const { return (-1 != fd_); }
+
+    FileDescriptor() = delete;
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor(FileDescriptor&&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(FileDescriptor&&) = delete;
+};
+}  // namespace opentxs
@@ -0,0 +1,79 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unordered_set>
+
+using namespace opentxs;
+
+namespace
+{
+OTIdentifier make_id(const std::string& bytes)
+{
+    auto output = Identifier::Factory();
+    output->Assign(bytes.data(), bytes.size());
+
+    return output;
+}
+}  // namespace
+
+TEST(Identifier, compare_empty)
+{
+    auto one = Identifier::Factory();
+    auto other = Identifier::Factory();
+    auto full = make_id("abcd");
+
+    ASSERT_TRUE(one.get() == other.get());
+    ASSERT_FALSE(one.get() < other.get());
+    ASSERT_TRUE(one.get() < full.get());
+    ASSERT_TRUE(full.get() > one.get());
+}
+
+TEST(Identifier, compare_equal)
+{
+    auto one = make_id("abcd");
+    auto other = make_id("abcd");
+
+    ASSERT_TRUE(one.get() == other.get());
+    ASSERT_FALSE(one.get() != other.get());
+    ASSERT_TRUE(one.get() <= other.get());
+    ASSERT_TRUE(one.get() >= other.get());
+    ASSERT_FALSE(one.get() < other.get());
+    ASSERT_FALSE(one.get() > other.get());
+}
+
+TEST(Identifier, compare_ordered)
+{
+    auto one = make_id("abcd");
+    auto other = make_id("abce");
+    auto longer = make_id("abcde");
+
+    ASSERT_TRUE(one.get() != other.get());
+    ASSERT_TRUE(one.get() < other.get());
+    ASSERT_TRUE(other.get() > one.get());
+    ASSERT_TRUE(one.get() < longer.get());
+    ASSERT_TRUE(longer.get() < other.get());
+}
+
+TEST(Identifier, hash)
+{
+    auto one = make_id("abcdefghijklmnopqrst");
+    auto other = make_id("abcdefghijklmnopqrst");
+    auto different = make_id("zbcdefghijklmnopqrst");
+    std::unordered_set<OTIdentifier> set{};
+
+    ASSERT_EQ(one->Hash(), other->Hash());
+    ASSERT_EQ(0, Identifier::Factory()->Hash());
+
+    set.emplace(one);
+    set.emplace(other);
+    set.emplace(different);
+
+    ASSERT_EQ(2, set.size());
+    ASSERT_EQ(1, set.count(make_id("abcdefghijklmnopqrst")));
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace opentxs;
+
+TEST(IntervalSet, insert_merges_ranges)
+{
+    IntervalSet set{};
+
+    ASSERT_TRUE(set.insert(1).second);
+    ASSERT_TRUE(set.insert(3).second);
+    ASSERT_EQ(2, set.GetRanges().size());
+    ASSERT_TRUE(set.insert(2).second);
+    ASSERT_FALSE(set.insert(2).second);
+    ASSERT_EQ(1, set.GetRanges().size());
+    ASSERT_EQ(3, set.size());
+    ASSERT_EQ(3, set.InsertRange(0, 5));
+    ASSERT_EQ(0, set.InsertRange(2, 4));
+    ASSERT_EQ(6, set.size());
+    ASSERT_EQ(1, set.GetRanges().size());
+    ASSERT_EQ("0,1,2,3,4,5", set.Encode());
+    ASSERT_EQ("0-5", set.EncodeRanges());
+}
+
+TEST(IntervalSet, erase_splits_ranges)
+{
+    IntervalSet set{};
+    set.InsertRange(1, 10);
+
+    ASSERT_EQ(1, set.erase(5));
+    ASSERT_EQ(0, set.erase(5));
+    ASSERT_EQ(1, set.erase(1));
+    ASSERT_EQ(1, set.erase(10));
+    ASSERT_EQ(0, set.erase(11));
+    ASSERT_EQ(0, set.count(5));
+    ASSERT_EQ(1, set.count(6));
+    ASSERT_EQ(7, set.size());
+    ASSERT_EQ(2, set.GetRanges().size());
+    ASSERT_EQ("2,3,4,6,7,8,9", set.Encode());
+    ASSERT_EQ("2-4,6-9", set.EncodeRanges());
+}
+
+TEST(IntervalSet, iterate)
+{
+    const std::set<std::int64_t> expected{1, 2, 3, 7, 9, 10};
+    const IntervalSet set{expected};
+    std::set<std::int64_t> values{};
+
+    for (const auto& value : set) { values.insert(value); }
+
+    ASSERT_EQ(expected, values);
+    ASSERT_EQ(expected, set.Set());
+    ASSERT_EQ(6, set.size());
+    ASSERT_EQ(1, *set.begin());
+}
+
+TEST(IntervalSet, decode)
+{
+    IntervalSet set{};
+
+    ASSERT_TRUE(set.Decode("1-5,7,9-12"));
+    ASSERT_EQ(10, set.size());
+    ASSERT_EQ(3, set.GetRanges().size());
+    ASSERT_EQ("1,2,3,4,5,7,9,10,11,12", set.Encode());
+    ASSERT_EQ("1-5,7,9-12", set.EncodeRanges());
+    ASSERT_TRUE(set.Decode(" 3, 1,2 4"));
+    ASSERT_EQ("1,2,3,4", set.Encode());
+    ASSERT_TRUE(set.Decode(""));
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.Decode("1,2,x"));
+    ASSERT_EQ("1,2", set.Encode());
+    ASSERT_FALSE(set.Decode("5-3"));
+    ASSERT_FALSE(set.Decode("1-"));
+}
+
+TEST(IntervalSet, decode_limit)
+{
+    IntervalSet set{};
+
+    ASSERT_TRUE(set.Decode("1-100000"));
+    ASSERT_EQ(100000, set.size());
+    ASSERT_FALSE(set.Decode("1-100001"));
+    ASSERT_FALSE(set.Decode("1-99999,200000-200001"));
+    ASSERT_EQ(99999, set.size());
+    ASSERT_FALSE(set.Decode("1-9223372036854775806"));
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.Decode("-9223372036854775808-9223372036854775807"));
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(IntervalSet, numlist)
+{
+    NumList list{std::string("1,2,3,4,5,7")};
+    auto output = String::Factory();
+
+    ASSERT_TRUE(list.Output(output));
+    ASSERT_STREQ("1,2,3,4,5,7", output->Get());
+    ASSERT_EQ(6, list.Count());
+    ASSERT_FALSE(list.Add(std::string("4-8")));
+    ASSERT_EQ(8, list.Count());
+    ASSERT_TRUE(list.Verify(NumList(std::string("1-8"))));
+    ASSERT_FALSE(list.Add(std::string("1-9223372036854775806")));
+    ASSERT_EQ(8, list.Count());
+}
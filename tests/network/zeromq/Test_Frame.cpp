@@ -82,3 +82,35 @@ TEST(Frame, zmq_msg_t)
     zmq_msg_t* zmq_msg = message.get();
     ASSERT_NE(nullptr, zmq_msg);
 }
+
+TEST(Frame, Factory_move)
+{
+    std::string input(4096, 'x');
+    const void* buffer = input.data();
+
+    auto message = network::zeromq::Frame::Factory(std::move(input));
+
+    ASSERT_EQ(4096, message->size());
+    ASSERT_EQ(buffer, message->data());
+    ASSERT_EQ(std::string(4096, 'x'), std::string(message.get()));
+}
+
+TEST(Frame, Factory_move_small)
+{
+    std::string input("testString");
+
+    auto message = network::zeromq::Frame::Factory(std::move(input));
+
+    ASSERT_EQ(10, message->size());
+    std::string messageString = message.get();
+    ASSERT_STREQ("testString", messageString.c_str());
+}
+
+TEST(Frame, copy_shares_payload)
+{
+    auto message = network::zeromq::Frame::Factory(std::string(4096, 'x'));
+    OTZMQFrame copy{message};
+
+    ASSERT_EQ(message->size(), copy->size());
+    ASSERT_EQ(message->data(), copy->data());
+}
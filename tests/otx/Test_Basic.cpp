@@ -426,6 +426,16 @@ TEST_F(Test_Basic, getNymbox_after_transaction_numbers)
     EXPECT_TRUE(transaction.IsAbbreviated());
     EXPECT_EQ(transactionType::blank, transaction.GetType());
     EXPECT_FALSE(nymbox->LoadBoxReceipt(number));
+
+    std::set<std::int64_t> unloaded{};
+
+    EXPECT_TRUE(nymbox->LoadBoxReceipts(std::set<std::int64_t>{}, &unloaded));
+    EXPECT_TRUE(unloaded.empty());
+
+    const std::set<std::int64_t> page{number};
+
+    EXPECT_FALSE(nymbox->LoadBoxReceipts(page, &unloaded));
+    EXPECT_EQ(page, unloaded);
 }
 
 TEST_F(Test_Basic, getBoxReceipt_transaction_numbers)
@@ -487,6 +497,12 @@ TEST_F(Test_Basic, getBoxReceipt_transaction_numbers)
     const auto& transaction = *transactionMap.begin()->second;
 
     EXPECT_FALSE(transaction.IsAbbreviated());
+
+    std::set<std::int64_t> unloaded{};
+    const std::set<std::int64_t> page{number};
+
+    EXPECT_TRUE(nymbox->LoadBoxReceipts(page, &unloaded));
+    EXPECT_TRUE(unloaded.empty());
 }
 
 TEST_F(Test_Basic, processNymbox)